@@ -0,0 +1,122 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CPL_DATA_STRUCTURE_CONCURRENT_DISJOINT_SET_HPP
+#define CPL_DATA_STRUCTURE_CONCURRENT_DISJOINT_SET_HPP
+
+#include <atomic>  // atomic
+#include <cstddef> // size_t
+#include <memory>  // unique_ptr
+
+namespace cpl {
+
+/// \brief Disjoint-set which can be shared by several threads.
+///
+/// It has the same interface as \c disjoint_set. Every element points to a
+/// parent with a smaller or equal index, and roots point to themselves.
+/// Unions link the root with the larger index under the other one with a
+/// single compare-and-swap, and finds compress paths by halving, also with
+/// compare-and-swap. A failed compression is simply skipped, so finds never
+/// wait for other threads, and a union only retries when another thread
+/// linked one of its roots first.
+///
+class concurrent_disjoint_set {
+  std::unique_ptr<std::atomic<size_t>[]> parent;
+
+public:
+  /// \brief Constructs a concurrent disjoint-set object.
+  ///
+  /// Creates \p n elements indexed with integers from \c 0 to <tt>n - 1</tt>,
+  /// each one in a singleton set.
+  ///
+  /// \param n The number of elements to be used.
+  ///
+  /// \par Complexity
+  /// Linear in the number of elements.
+  ///
+  explicit concurrent_disjoint_set(size_t n)
+      : parent(new std::atomic<size_t>[n]) {
+    for (size_t x = 0; x != n; ++x)
+      parent[x].store(x, std::memory_order_relaxed);
+  }
+
+  /// \brief Finds the representative element of the set containing \p x.
+  ///
+  /// The representative may change if other threads are merging sets.
+  ///
+  /// \param x Member of the set to be searched.
+  ///
+  /// \returns The index of the representative element found.
+  ///
+  /// \par Complexity
+  /// Logarithmic amortized over random union orders.
+  ///
+  size_t find_set(size_t x) {
+    while (true) {
+      size_t p = parent[x].load(std::memory_order_acquire);
+      if (p == x)
+        return x;
+      const size_t grandparent = parent[p].load(std::memory_order_acquire);
+      if (p != grandparent) // Path halving
+        parent[x].compare_exchange_weak(p, grandparent,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed);
+      x = grandparent;
+    }
+  }
+
+  /// \brief Checks whether \p x and \p y are in the same set.
+  ///
+  /// \param x Member of the first set.
+  /// \param y Member of the second set.
+  ///
+  /// \returns \c true if \p x and \p y were found in the same set at some
+  /// point during the call.
+  ///
+  bool same_set(size_t x, size_t y) {
+    while (true) {
+      x = find_set(x);
+      y = find_set(y);
+      if (x == y)
+        return true;
+      // 'x' could have been linked after it was found.
+      if (parent[x].load(std::memory_order_acquire) == x)
+        return false;
+    }
+  }
+
+  /// \brief Merges the set containing \p x with the set containing \p y.
+  ///
+  /// \param x Member of the first set.
+  /// \param y Member of the second set.
+  ///
+  /// \returns \c true if this call merged two different sets. If several
+  /// threads merge the same two sets, only one of them gets \c true.
+  ///
+  /// \par Complexity
+  /// Logarithmic amortized over random union orders.
+  ///
+  bool union_set(size_t x, size_t y) {
+    while (true) {
+      x = find_set(x);
+      y = find_set(y);
+      if (x == y)
+        return false;
+      if (x < y) {
+        const size_t tmp = x;
+        x = y;
+        y = tmp;
+      }
+      size_t expected = x;
+      if (parent[x].compare_exchange_strong(expected, y,
+                                            std::memory_order_acq_rel))
+        return true;
+    }
+  }
+};
+
+} // namespace cpl
+
+#endif // Header guard
@@ -43,9 +43,15 @@ public:
   /// The amortized complexity is constant.
   ///
   size_t find_set(size_t x) {
-    if (parent[x] != x)
-      parent[x] = find_set(parent[x]);
-    return parent[x];
+    size_t root = x;
+    while (parent[root] != root)
+      root = parent[root];
+    while (parent[x] != root) { // Path compression
+      const size_t next = parent[x];
+      parent[x] = root;
+      x = next;
+    }
+    return root;
   }
 
   /// \brief Merges the set containing \p x with the set containing \p y.
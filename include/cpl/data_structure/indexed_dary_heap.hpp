@@ -0,0 +1,204 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Defines the class \c indexed_dary_heap.
+
+#ifndef CPL_DATA_STRUCTURE_INDEXED_DARY_HEAP_HPP
+#define CPL_DATA_STRUCTURE_INDEXED_DARY_HEAP_HPP
+
+#include <cassert>    // assert
+#include <cstddef>    // size_t
+#include <cstdint>    // SIZE_MAX
+#include <functional> // less
+#include <vector>     // vector
+
+namespace cpl {
+
+/// \brief Priority queue of items indexed by integers, with decrease-key.
+///
+/// Each item is an integer in the range <tt>[0, N)</tt> with an associated
+/// key. The heap keeps the position of every item, so the key of a queued item
+/// can be decreased in place instead of pushing a duplicate entry.
+///
+/// \tparam Key Type of the keys.
+/// \tparam Arity Number of children of each node. Wider nodes make the heap
+/// shallower, which favors \c push and \c decrease_key over \c pop.
+/// \tparam Compare Strict weak ordering of keys. The item on top is the one
+/// with the lowest key according to it.
+///
+template <typename Key, size_t Arity = 4, typename Compare = std::less<Key>>
+class indexed_dary_heap {
+  static_assert(Arity >= 2, "'Arity' must be at least 2.");
+  static constexpr size_t npos = SIZE_MAX;
+
+public:
+  /// \brief Constructs an empty heap which accepts items in <tt>[0, n)</tt>.
+  ///
+  /// \par Complexity
+  /// Linear in \p n.
+  ///
+  explicit indexed_dary_heap(size_t n = 0, const Compare& comp_ = Compare())
+      : pos(n, npos), keys(n), comp(comp_) {}
+
+  /// \brief Changes the number of items accepted by the heap.
+  ///
+  /// \pre The heap must be empty.
+  ///
+  /// \par Complexity
+  /// Linear in the difference between the old and the new number of items.
+  ///
+  void resize(const size_t n) {
+    assert(empty());
+    pos.resize(n, npos);
+    keys.resize(n);
+  }
+
+  /// \brief Removes all the items from the heap.
+  ///
+  /// \par Complexity
+  /// Linear in the number of queued items.
+  ///
+  void clear() {
+    for (const size_t item : heap)
+      pos[item] = npos;
+    heap.clear();
+  }
+
+  bool empty() const {
+    return heap.empty();
+  }
+  size_t size() const {
+    return heap.size();
+  }
+
+  /// \brief Checks whether \p item is currently queued.
+  bool contains(const size_t item) const {
+    return pos[item] != npos;
+  }
+
+  /// \brief Returns the key of a queued item.
+  const Key& key(const size_t item) const {
+    assert(contains(item));
+    return keys[item];
+  }
+
+  /// \brief Returns the item with the lowest key.
+  ///
+  /// \pre The heap must not be empty.
+  ///
+  size_t top() const {
+    return heap.front();
+  }
+
+  /// \brief Returns the lowest key.
+  ///
+  /// \pre The heap must not be empty.
+  ///
+  const Key& top_key() const {
+    return keys[heap.front()];
+  }
+
+  /// \brief Inserts an item.
+  ///
+  /// \pre \p item must not be queued.
+  ///
+  /// \par Complexity
+  /// <tt>O(log(N) / log(Arity))</tt>.
+  ///
+  void push(const size_t item, const Key& k) {
+    assert(!contains(item));
+    keys[item] = k;
+    heap.push_back(item);
+    sift_up(heap.size() - 1);
+  }
+
+  /// \brief Replaces the key of a queued item by a lower one.
+  ///
+  /// \pre \p item must be queued and \p k must not be greater than its current
+  /// key.
+  ///
+  /// \par Complexity
+  /// <tt>O(log(N) / log(Arity))</tt>.
+  ///
+  void decrease_key(const size_t item, const Key& k) {
+    assert(contains(item) && !comp(keys[item], k));
+    keys[item] = k;
+    sift_up(pos[item]);
+  }
+
+  /// \brief Inserts \p item, or decreases its key if it is already queued.
+  void push_or_decrease(const size_t item, const Key& k) {
+    contains(item) ? decrease_key(item, k) : push(item, k);
+  }
+
+  /// \brief Removes the item with the lowest key.
+  ///
+  /// \pre The heap must not be empty.
+  ///
+  /// \par Complexity
+  /// <tt>O(Arity * log(N) / log(Arity))</tt>.
+  ///
+  void pop() {
+    assert(!empty());
+    pos[heap.front()] = npos;
+    const size_t last = heap.back();
+    heap.pop_back();
+    if (heap.empty())
+      return;
+    heap.front() = last;
+    pos[last] = 0;
+    sift_down(0);
+  }
+
+private:
+  void place(const size_t item, const size_t idx) {
+    heap[idx] = item;
+    pos[item] = idx;
+  }
+
+  void sift_up(size_t idx) {
+    const size_t item = heap[idx];
+    while (idx != 0) {
+      const size_t parent = (idx - 1) / Arity;
+      if (!comp(keys[item], keys[heap[parent]]))
+        break;
+      place(heap[parent], idx);
+      idx = parent;
+    }
+    place(item, idx);
+  }
+
+  void sift_down(size_t idx) {
+    const size_t item = heap[idx];
+    const size_t count = heap.size();
+    while (true) {
+      const size_t first = idx * Arity + 1;
+      if (first >= count)
+        break;
+      const size_t last = first + Arity < count ? first + Arity : count;
+      size_t best = first;
+      for (size_t child = first + 1; child < last; ++child)
+        if (comp(keys[heap[child]], keys[heap[best]]))
+          best = child;
+      if (!comp(keys[heap[best]], keys[item]))
+        break;
+      place(heap[best], idx);
+      idx = best;
+    }
+    place(item, idx);
+  }
+
+  std::vector<size_t> heap; // Items in heap order.
+  std::vector<size_t> pos;  // Position of each item in 'heap', or npos.
+  std::vector<Key> keys;
+  Compare comp;
+};
+
+template <typename Key, size_t Arity, typename Compare>
+constexpr size_t indexed_dary_heap<Key, Arity, Compare>::npos;
+
+} // end namespace cpl
+
+#endif // Header guard
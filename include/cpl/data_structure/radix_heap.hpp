@@ -0,0 +1,134 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Defines the class \c radix_heap.
+
+#ifndef CPL_DATA_STRUCTURE_RADIX_HEAP_HPP
+#define CPL_DATA_STRUCTURE_RADIX_HEAP_HPP
+
+#include <cassert>     // assert
+#include <cstddef>     // size_t
+#include <limits>      // numeric_limits
+#include <type_traits> // is_integral, is_unsigned
+#include <utility>     // pair
+#include <vector>      // vector
+
+namespace cpl {
+
+/// \brief Monotone min-priority queue for unsigned integer keys.
+///
+/// Elements are placed in buckets according to the highest bit in which their
+/// key differs from the last extracted key, so each element is moved between
+/// buckets at most once per bit of the key type. This requires that keys are
+/// never lower than the last extracted key, which holds for the tentative
+/// distances of the Dijkstra's algorithm.
+///
+/// \tparam Key Unsigned integer type of the keys.
+/// \tparam Value Type of the data attached to each key.
+///
+template <typename Key, typename Value>
+class radix_heap {
+  static_assert(std::is_integral<Key>::value && std::is_unsigned<Key>::value,
+                "'Key' must be an unsigned integer type.");
+
+  static constexpr size_t num_buckets = std::numeric_limits<Key>::digits + 1;
+
+public:
+  using value_type = std::pair<Key, Value>;
+
+  /// \brief Checks whether the heap has no elements.
+  bool empty() const {
+    return count == 0;
+  }
+
+  /// \brief Returns the number of elements in the heap.
+  size_t size() const {
+    return count;
+  }
+
+  /// \brief Inserts an element.
+  ///
+  /// \pre \p key must not be lower than the key of the last extracted element.
+  ///
+  /// \par Complexity
+  /// Constant.
+  ///
+  void push(const Key key, const Value& value) {
+    assert(key >= last);
+    buckets[bucket_of(key)].emplace_back(key, value);
+    ++count;
+  }
+
+  /// \brief Returns an element with the minimum key.
+  ///
+  /// \pre The heap must not be empty.
+  ///
+  /// \par Complexity
+  /// Amortized <tt>O(log(C))</tt> where \c C is the range of the keys.
+  ///
+  const value_type& top() {
+    pull();
+    return buckets[0].back();
+  }
+
+  /// \brief Removes an element with the minimum key.
+  ///
+  /// \pre The heap must not be empty.
+  ///
+  /// \par Complexity
+  /// Amortized <tt>O(log(C))</tt> where \c C is the range of the keys.
+  ///
+  void pop() {
+    pull();
+    buckets[0].pop_back();
+    --count;
+  }
+
+private:
+  // Number of bits needed to represent x. Uses a binary search over the bits.
+  static size_t bit_width(Key x) {
+    size_t width = 0;
+    for (int shift = std::numeric_limits<Key>::digits / 2; shift; shift /= 2) {
+      if ((x >> shift) != 0) {
+        x = static_cast<Key>(x >> shift);
+        width += static_cast<size_t>(shift);
+      }
+    }
+    return width + static_cast<size_t>(x);
+  }
+
+  size_t bucket_of(const Key key) const {
+    return bit_width(key ^ last);
+  }
+
+  // Ensures the minimum elements are in the first bucket.
+  void pull() {
+    assert(count != 0);
+    if (!buckets[0].empty())
+      return;
+    size_t i = 1;
+    while (buckets[i].empty())
+      ++i;
+
+    last = buckets[i].front().first;
+    for (const auto& elem : buckets[i])
+      if (elem.first < last)
+        last = elem.first;
+
+    // Every element lands in a lower bucket, since it shares with the new
+    // minimum all the bits above bit i - 1.
+    for (const auto& elem : buckets[i])
+      buckets[bucket_of(elem.first)].push_back(elem);
+    buckets[i].clear();
+  }
+
+  std::vector<value_type> buckets[num_buckets];
+  Key last = 0;
+  size_t count = 0;
+};
+
+} // end namespace cpl
+
+#endif // Header guard
@@ -0,0 +1,130 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef CPL_DATA_STRUCTURE_ROLLBACK_DISJOINT_SET_HPP
+#define CPL_DATA_STRUCTURE_ROLLBACK_DISJOINT_SET_HPP
+
+#include <cassert> // assert
+#include <cstddef> // size_t
+#include <utility> // pair
+#include <vector>  // vector
+
+namespace cpl {
+
+/// \brief Disjoint-set whose unions can be undone.
+///
+/// Sets are merged by rank but paths are never compressed, so every union
+/// changes at most two entries and can be undone exactly. Successful unions
+/// are recorded in a history stack, and \c rollback undoes them in reverse
+/// order.
+///
+class rollback_disjoint_set {
+  std::vector<size_t> parent, rank;
+  std::vector<std::pair<size_t, bool>> history; // Linked root, rank change.
+  size_t num_sets_;
+
+public:
+  /// \brief Constructs a rollback disjoint-set object.
+  ///
+  /// Creates \p n elements indexed with integers from \c 0 to <tt>n - 1</tt>,
+  /// each one in a singleton set.
+  ///
+  /// \param n The number of elements to be used.
+  ///
+  /// \par Complexity
+  /// Linear in the number of elements.
+  ///
+  explicit rollback_disjoint_set(size_t n)
+      : parent(n), rank(n, 0), num_sets_(n) {
+    for (size_t x = 0; x != n; ++x)
+      parent[x] = x;
+  }
+
+  /// \brief Finds the representative element of the set containing \p x.
+  ///
+  /// \param x Member of the set to be searched.
+  ///
+  /// \returns The index of the representative element of the searched set.
+  ///
+  /// \par Complexity
+  /// <tt>O(log(N))</tt>.
+  ///
+  size_t find_set(size_t x) const {
+    while (parent[x] != x)
+      x = parent[x];
+    return x;
+  }
+
+  /// \brief Merges the set containing \p x with the set containing \p y.
+  ///
+  /// \param x Member of the first set.
+  /// \param y Member of the second set.
+  ///
+  /// \returns \c true if \p x and \p y were part of different sets so an union
+  /// was made and recorded. Otherwise \c false, and nothing is recorded.
+  ///
+  /// \par Complexity
+  /// <tt>O(log(N))</tt>.
+  ///
+  bool union_set(size_t x, size_t y) {
+    x = find_set(x);
+    y = find_set(y);
+    if (x == y)
+      return false;
+    if (rank[x] < rank[y]) {
+      const size_t tmp = x;
+      x = y;
+      y = tmp;
+    }
+    const bool same_rank = rank[x] == rank[y];
+    parent[y] = x;
+    rank[x] += same_rank;
+    history.emplace_back(y, same_rank);
+    --num_sets_;
+    return true;
+  }
+
+  /// \brief Returns a token for the current state, to be passed to
+  /// \c rollback.
+  ///
+  /// \par Complexity
+  /// Constant.
+  ///
+  size_t snapshot() const {
+    return history.size();
+  }
+
+  /// \brief Undoes the unions made after \p snapshot was taken.
+  ///
+  /// \param snapshot A value returned by \c snapshot, not newer than any
+  /// rollback made since then.
+  ///
+  /// \par Complexity
+  /// Linear in the number of undone unions.
+  ///
+  void rollback(size_t snapshot) {
+    assert(snapshot <= history.size());
+    while (history.size() != snapshot) {
+      const size_t y = history.back().first;
+      rank[parent[y]] -= history.back().second;
+      parent[y] = y;
+      history.pop_back();
+      ++num_sets_;
+    }
+  }
+
+  /// \brief Returns the number of disjoint sets.
+  ///
+  /// \par Complexity
+  /// Constant.
+  ///
+  size_t num_sets() const {
+    return num_sets_;
+  }
+};
+
+} // namespace cpl
+
+#endif // Header guard
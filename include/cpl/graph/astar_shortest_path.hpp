@@ -0,0 +1,131 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the A* search algorithm.
+
+#ifndef CPL_GRAPH_ASTAR_SHORTEST_PATH_HPP
+#define CPL_GRAPH_ASTAR_SHORTEST_PATH_HPP
+
+#include <cpl/data_structure/indexed_dary_heap.hpp> // indexed_dary_heap
+#include <algorithm>                                // reverse, copy
+#include <cstddef>                                  // size_t
+#include <limits>                                   // numeric_limits
+#include <vector>                                   // vector
+
+namespace cpl {
+
+namespace detail {
+
+// Runs the search and returns the distance to t. 'pred' receives the edge
+// used to reach each vertex.
+template <class Graph, class Distance, class Heuristic>
+Distance astar_search(const Graph& g, const size_t s, const size_t t,
+                      const std::vector<Distance>& weight, Heuristic h,
+                      std::vector<typename Graph::index_type>& pred) {
+  using index_type = typename Graph::index_type;
+  const auto inf = std::numeric_limits<Distance>::max();
+
+  std::vector<Distance> dist(g.num_vertices(), inf);
+  pred.assign(g.num_vertices(), std::numeric_limits<index_type>::max());
+  indexed_dary_heap<Distance> heap(g.num_vertices());
+
+  dist[s] = 0;
+  heap.push(s, h(s));
+  while (!heap.empty()) {
+    const auto u = static_cast<index_type>(heap.top());
+    if (u == t)
+      return dist[t];
+    heap.pop();
+
+    for (const auto edge : g.out_edges(u)) {
+      const index_type v = g.target(edge);
+      const Distance alt = dist[u] + weight[edge]; // alternative
+      if (alt >= dist[v])
+        continue;
+      dist[v] = alt;
+      pred[v] = edge;
+      // A vertex may be queued again if the heuristic is not consistent.
+      heap.push_or_decrease(v, alt + h(v));
+    }
+  }
+  return inf;
+}
+
+} // end namespace detail
+
+/// \brief Finds the shortest distance between two vertices, guided by a
+/// heuristic.
+///
+/// Vertices are extracted in increasing order of <tt>dist[v] + h(v)</tt>
+/// and the search stops when \p t is extracted. A heuristic close to the true
+/// distance to \p t leaves most vertices untouched, while <tt>h(v) = 0</tt>
+/// makes the algorithm equivalent to the Dijkstra's algorithm.
+///
+/// \param g The target graph.
+/// \param s The source vertex.
+/// \param t The target vertex.
+/// \param weight Weight map of edges.
+/// \param h Function invoked as <tt>h(v)</tt> which returns a lower bound of
+/// the distance from \c v to \p t.
+///
+/// \returns The shortest distance from \p s to \p t, or
+/// <tt>std::numeric_limits<Distance>::max()</tt> if \p t is not reachable
+/// from \p s.
+///
+/// \pre All weights must be non-negative and \p h must never overestimate.
+///
+/// \par Complexity
+/// <tt>O(E * log(V))</tt> if \p h is consistent i.e
+/// <tt>h(u) <= weight[e] + h(v)</tt> for each edge \c e from \c u to \c v.
+/// Otherwise vertices may be extracted several times.
+///
+/// \sa dijkstra_shortest_paths, bidirectional_dijkstra
+///
+template <class Graph, class Distance, class Heuristic>
+Distance astar_shortest_path(const Graph& g, const size_t s, const size_t t,
+                             const std::vector<Distance>& weight, Heuristic h) {
+  std::vector<typename Graph::index_type> pred;
+  return detail::astar_search(g, s, t, weight, h, pred);
+}
+
+/// \brief Finds a shortest path between two vertices, guided by a heuristic.
+///
+/// \param g The target graph.
+/// \param s The source vertex.
+/// \param t The target vertex.
+/// \param weight Weight map of edges.
+/// \param h Function invoked as <tt>h(v)</tt> which returns a lower bound of
+/// the distance from \c v to \p t.
+/// \param out_it Beginning of the destination range. The vertices of a
+/// shortest path from \p s to \p t are copied to this range, in order. Nothing
+/// is copied if \p t is not reachable from \p s.
+///
+/// \returns The shortest distance from \p s to \p t, or
+/// <tt>std::numeric_limits<Distance>::max()</tt> if \p t is not reachable
+/// from \p s.
+///
+/// \pre All weights must be non-negative and \p h must never overestimate.
+///
+template <class Graph, class Distance, class Heuristic, class OutputIt>
+Distance astar_shortest_path(const Graph& g, const size_t s, const size_t t,
+                             const std::vector<Distance>& weight, Heuristic h,
+                             OutputIt out_it) {
+  using index_type = typename Graph::index_type;
+  std::vector<index_type> pred;
+  const Distance dist = detail::astar_search(g, s, t, weight, h, pred);
+  if (dist == std::numeric_limits<Distance>::max())
+    return dist;
+
+  std::vector<index_type> path = {static_cast<index_type>(t)};
+  while (path.back() != s)
+    path.push_back(g.source(pred[path.back()]));
+  std::reverse(path.begin(), path.end());
+  std::copy(path.begin(), path.end(), out_it);
+  return dist;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
@@ -0,0 +1,163 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the auction algorithm for the assignment problem.
+
+#ifndef CPL_GRAPH_AUCTION_ASSIGNMENT_HPP
+#define CPL_GRAPH_AUCTION_ASSIGNMENT_HPP
+
+#include <cpl/utility/matrix.hpp>   // matrix
+#include <cpl/utility/parallel.hpp> // parallel_for
+#include <algorithm>                // max
+#include <cassert>                  // assert
+#include <cstddef>                  // size_t
+#include <limits>                   // numeric_limits
+#include <type_traits>              // is_integral, is_signed
+#include <vector>                   // vector
+
+namespace cpl {
+
+/// \brief Solves the assignment problem using the Bertsekas' auction
+/// algorithm with epsilon scaling.
+///
+/// Unassigned rows bid for the column which gives them the best value (the
+/// negated cost minus the current price of the column), raising its price by
+/// the difference with their second best option plus \c eps. The previous
+/// owner of the column becomes unassigned. Costs are multiplied by
+/// <tt>N + 1</tt>, so an assignment found with <tt>eps = 1</tt> is optimal.
+/// Prices are kept between phases of decreasing \c eps, which makes each
+/// phase short.
+///
+/// With a single thread, rows bid one at a time (Gauss-Seidel auction).
+/// Otherwise all the unassigned rows bid at once against the same prices,
+/// their bids are computed by \p num_threads threads, and each column goes
+/// to its highest bidder (Jacobi auction).
+///
+/// \param cost The cost matrix. <tt>cost[i][j]</tt> is the cost of assigning
+/// row \c i to column \c j.
+/// \param[out] assignment The column assigned to each row.
+/// \param num_threads The number of threads used to compute the bids.
+///
+/// \returns The total cost of the assignment.
+///
+/// \pre <tt>cost.num_rows() == cost.num_cols()</tt>
+///
+/// \par Complexity
+/// Each bid takes <tt>O(N)</tt> time and there are <tt>O(log(N * C))</tt>
+/// phases, where \c C is the largest absolute cost. The number of bids per
+/// phase is pseudo-polynomial in the worst case, but usually small.
+///
+/// \sa hungarian_assignment
+///
+template <typename T>
+T auction_assignment(const matrix<T>& cost, std::vector<size_t>& assignment,
+                     const size_t num_threads = 1) {
+  static_assert(std::is_integral<T>::value && std::is_signed<T>::value,
+                "'T' must be a signed integer.");
+  using value_type = long long;
+  const size_t n = cost.num_rows();
+  assert(n == cost.num_cols());
+  const size_t nil = n;
+  const value_type lowest = std::numeric_limits<value_type>::min();
+  const auto scale = static_cast<value_type>(n + 1);
+  const value_type scale_factor = 8; // Division of eps between phases.
+
+  value_type eps = 0;
+  for (size_t i = 0; i != n; ++i)
+    for (size_t j = 0; j != n; ++j)
+      eps = std::max(eps, static_cast<value_type>(cost[i][j] < 0 ? -cost[i][j]
+                                                                 : cost[i][j]));
+  eps *= scale;
+
+  std::vector<value_type> price(n, 0);
+  std::vector<size_t> owner(n);
+  std::vector<size_t> unassigned;
+
+  // Finds the best column for the row 'i' and the raise of its price.
+  auto make_bid = [&](const size_t i, size_t& best_col, value_type& raise) {
+    const auto cost_row = cost[i];
+    best_col = 0;
+    value_type best = lowest, second = lowest;
+    for (size_t j = 0; j != n; ++j) {
+      const value_type value =
+          -static_cast<value_type>(cost_row[j]) * scale - price[j];
+      if (value > best) {
+        second = best;
+        best = value;
+        best_col = j;
+      } else if (value > second)
+        second = value;
+    }
+    // With a single column there is no second best option.
+    raise = (second == lowest ? 0 : best - second) + eps;
+  };
+  auto assign = [&](const size_t i, const size_t col, const value_type raise) {
+    price[col] += raise;
+    if (owner[col] != nil) {
+      assignment[owner[col]] = nil;
+      unassigned.push_back(owner[col]);
+    }
+    owner[col] = i;
+    assignment[i] = col;
+  };
+
+  // Bids of the unassigned rows and winning bid of each column, for the
+  // Jacobi rounds.
+  std::vector<size_t> bidders, bid_col, winner(n, nil);
+  std::vector<value_type> bid_raise;
+  do {
+    eps = std::max<value_type>(1, eps / scale_factor);
+    owner.assign(n, nil);
+    assignment.assign(n, nil);
+    for (size_t i = n; i-- > 0;)
+      unassigned.push_back(i);
+
+    while (!unassigned.empty()) {
+      if (num_threads <= 1) {
+        const size_t i = unassigned.back();
+        unassigned.pop_back();
+        size_t col;
+        value_type raise;
+        make_bid(i, col, raise);
+        assign(i, col, raise);
+        continue;
+      }
+
+      bidders.swap(unassigned);
+      bid_col.resize(bidders.size());
+      bid_raise.resize(bidders.size());
+      parallel_for(bidders.size(), num_threads,
+                   [&](size_t, const size_t first, const size_t last) {
+                     for (size_t k = first; k != last; ++k)
+                       make_bid(bidders[k], bid_col[k], bid_raise[k]);
+                   });
+      for (size_t k = 0; k != bidders.size(); ++k) {
+        size_t& best = winner[bid_col[k]];
+        if (best == nil || bid_raise[k] > bid_raise[best]) {
+          if (best != nil)
+            unassigned.push_back(bidders[best]);
+          best = k;
+        } else
+          unassigned.push_back(bidders[k]);
+      }
+      for (size_t k = 0; k != bidders.size(); ++k) {
+        if (winner[bid_col[k]] == k) {
+          winner[bid_col[k]] = nil;
+          assign(bidders[k], bid_col[k], bid_raise[k]);
+        }
+      }
+      bidders.clear();
+    }
+  } while (eps > 1);
+
+  T total = 0;
+  for (size_t i = 0; i != n; ++i)
+    total += cost[i][assignment[i]];
+  return total;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
@@ -6,16 +6,134 @@
 #ifndef CPL_GRAPH_BICONNECTED_COMPONENTS_HPP
 #define CPL_GRAPH_BICONNECTED_COMPONENTS_HPP
 
-#include <algorithm>  // min
-#include <cstddef>    // size_t
-#include <cstdint>    // SIZE_MAX
-#include <functional> // function
-#include <stack>      // stack
-#include <utility>    // pair
-#include <vector>     // vector
+#include <cpl/graph/depth_first_search.hpp> // depth_first_search
+#include <algorithm>                         // min
+#include <cstddef>                           // size_t
+#include <limits>                            // numeric_limits
+#include <utility>                           // pair
+#include <vector>                            // vector
 
 namespace cpl {
 
+namespace detail {
+
+template <typename Graph, typename Label>
+class biconnected_components_visitor : public dfs_visitor {
+  using index_type = typename Graph::index_type;
+
+public:
+  biconnected_components_visitor(const size_t num_vertices,
+                                 std::vector<Label>& bicomp_,
+                                 std::vector<bool>& is_articulation_)
+      : pred(num_vertices, nil), dtm(num_vertices), low(num_vertices),
+        bicomp(bicomp_), is_articulation(is_articulation_) {}
+
+  void start_vertex(size_t) {
+    children_of_root = 0;
+  }
+  void discover_vertex(const index_type v) {
+    low[v] = dtm[v] = ++time;
+  }
+  void tree_edge(const index_type e, const index_type u, const index_type v) {
+    stack.emplace_back(e, u);
+    pred[v] = u;
+    if (pred[u] == nil)
+      ++children_of_root;
+  }
+  void back_edge(const index_type e, const index_type u, const index_type v) {
+    if (v == pred[u])
+      return;
+    stack.emplace_back(e, u);
+    low[u] = std::min(low[u], dtm[v]);
+  }
+  void finish_edge(index_type, const index_type u, const index_type v) {
+    low[u] = std::min(low[u], low[v]);
+  }
+  void finish_vertex(const index_type v) {
+    const auto parent = pred[v];
+    if (parent == nil) {
+      is_articulation[v] = children_of_root > 1;
+      return;
+    }
+    if (low[v] < dtm[parent])
+      return;
+    is_articulation[parent] = true;
+    while (dtm[stack.back().second] >= dtm[v]) {
+      bicomp[stack.back().first] = static_cast<Label>(comp_cnt);
+      stack.pop_back();
+    }
+    bicomp[stack.back().first] = static_cast<Label>(comp_cnt++);
+    stack.pop_back();
+  }
+
+  size_t num_components() const {
+    return comp_cnt;
+  }
+
+private:
+  const index_type nil = std::numeric_limits<index_type>::max();
+  index_type time = 0;
+  size_t children_of_root = 0;
+  size_t comp_cnt = 0;
+  std::vector<std::pair<index_type, index_type>> stack; // edge, source of edge
+  std::vector<index_type> pred;
+  std::vector<index_type> dtm;
+  std::vector<index_type> low;
+  std::vector<Label>& bicomp;
+  std::vector<bool>& is_articulation;
+};
+
+template <typename Graph, typename UnaryFunction>
+class articulation_points_visitor : public dfs_visitor {
+  using index_type = typename Graph::index_type;
+
+public:
+  articulation_points_visitor(const size_t num_vertices,
+                              std::vector<bool>& is_articulation_,
+                              UnaryFunction& output_bridge_)
+      : pred(num_vertices, nil), dtm(num_vertices), low(num_vertices),
+        is_articulation(is_articulation_), output_bridge(output_bridge_) {}
+
+  void start_vertex(size_t) {
+    children_of_root = 0;
+  }
+  void discover_vertex(const index_type v) {
+    low[v] = dtm[v] = ++time;
+  }
+  void tree_edge(index_type, const index_type u, const index_type v) {
+    pred[v] = u;
+    if (pred[u] == nil)
+      ++children_of_root;
+  }
+  void back_edge(index_type, const index_type u, const index_type v) {
+    if (v != pred[u])
+      low[u] = std::min(low[u], dtm[v]);
+  }
+  void finish_edge(const index_type e, const index_type u, const index_type v) {
+    if (low[v] >= dtm[u])
+      is_articulation[u] = true;
+    if (low[v] > dtm[u])
+      output_bridge(e);
+    low[u] = std::min(low[u], low[v]);
+  }
+  void finish_vertex(const index_type v) {
+    if (pred[v] == nil)
+      is_articulation[v] = children_of_root > 1; // Fix root flag.
+  }
+
+private:
+  const index_type nil = std::numeric_limits<index_type>::max();
+  index_type time = 0;
+  size_t children_of_root = 0;
+  std::vector<index_type> pred;
+  std::vector<index_type> dtm;
+  std::vector<index_type> low;
+  std::vector<bool>& is_articulation;
+  UnaryFunction& output_bridge;
+};
+
+} // end namespace detail
+
 /// \brief Finds the biconnected components of an undirected graph.
 ///
 /// Uses the Tarjan's algorithm to find the biconnected components and
@@ -45,67 +163,17 @@ namespace cpl {
 /// \note This function can  also be used to find bridges. If and edge \c e is
 /// the unique member of its biconnected component, then \c e is a bridge.
 ///
-template <typename Graph>
-size_t biconnected_components(const Graph& g, std::vector<size_t>& bicomp,
+template <typename Graph, typename Label>
+size_t biconnected_components(const Graph& g, std::vector<Label>& bicomp,
                               std::vector<bool>& is_articulation) {
-
-  enum colors { white, gray, black };
   const size_t num_vertices = g.num_vertices();
-  size_t time = 0;
-  size_t children_of_root = 0;
-  size_t comp_cnt = 0;
-  std::stack<std::pair<size_t, size_t>> stack; // edge, source of edge
-  std::vector<size_t> pred(num_vertices, SIZE_MAX);
-  std::vector<size_t> dtm(num_vertices);
-  std::vector<size_t> low(num_vertices);
-  std::vector<colors> color(num_vertices, white);
   is_articulation.assign(num_vertices, false);
   bicomp.resize(g.num_edges());
 
-  std::function<void(size_t)> dfs_visit;
-  dfs_visit = [&](const size_t src) {
-    color[src] = gray;
-    low[src] = dtm[src] = ++time;
-    for (const auto e : g.out_edges(src)) {
-      const size_t tgt = (src == g.source(e)) ? g.target(e) : g.source(e);
-      if (tgt == pred[src])
-        continue;
-      if (color[tgt] == white) {
-        stack.emplace(e, src);
-        pred[tgt] = src;
-        if (pred[src] == SIZE_MAX)
-          ++children_of_root;
-        dfs_visit(tgt);
-        low[src] = std::min(low[src], low[tgt]);
-      } else if (color[tgt] == gray) {
-        stack.emplace(e, src);
-        low[src] = std::min(low[src], dtm[tgt]);
-      }
-    }
-    color[src] = black;
-    const auto parent = pred[src];
-    if (parent == SIZE_MAX) {
-      is_articulation[src] = children_of_root > 1;
-      return;
-    }
-    if (low[src] < dtm[parent])
-      return;
-    is_articulation[parent] = true;
-    while (dtm[stack.top().second] >= dtm[src]) {
-      bicomp[stack.top().first] = comp_cnt;
-      stack.pop();
-    }
-    bicomp[stack.top().first] = comp_cnt++;
-    stack.pop();
-  };
-
-  for (size_t v = 0; v != num_vertices; ++v) {
-    if (color[v] == white) {
-      children_of_root = 0;
-      dfs_visit(v);
-    }
-  }
-  return comp_cnt;
+  detail::biconnected_components_visitor<Graph, Label> vis(
+      num_vertices, bicomp, is_articulation);
+  depth_first_search(g, vis);
+  return vis.num_components();
 }
 
 /// \brief Uses the Tarjan's algorithm to find the articulation points and
@@ -135,42 +203,14 @@ void articulation_points_and_bridges(const Graph& g,
                                      Out2 output_bridge) {
 
   const size_t num_v = g.num_vertices();
-  size_t children_of_root = 0;
-  size_t time = 0;
-  std::vector<size_t> pred(num_v, SIZE_MAX);
-  std::vector<size_t> dtm(num_v);
-  std::vector<size_t> low(num_v);
   std::vector<bool> is_articulation(num_v);
+  detail::articulation_points_visitor<Graph, Out2> vis(num_v, is_articulation,
+                                                       output_bridge);
+  depth_first_search(g, vis);
 
-  std::function<void(size_t)> dfs_visit;
-  dfs_visit = [&](const size_t src) {
-    low[src] = dtm[src] = ++time;
-    for (const auto e : g.out_edges(src)) {
-      const size_t tgt = (src == g.source(e)) ? g.target(e) : g.source(e);
-      if (!dtm[tgt]) {
-        pred[tgt] = src;
-        if (pred[src] == SIZE_MAX)
-          ++children_of_root;
-        dfs_visit(tgt);
-        if (low[tgt] >= dtm[src])
-          is_articulation[src] = true;
-        if (low[tgt] > dtm[src])
-          output_bridge(e);
-        low[src] = std::min(low[src], low[tgt]);
-      } else if (tgt != pred[src])
-        low[src] = std::min(low[src], dtm[tgt]);
-    }
-  };
-
-  for (size_t v = 0; v != num_v; ++v) {
-    if (!dtm[v]) {
-      children_of_root = 0;
-      dfs_visit(v);
-      is_articulation[v] = children_of_root > 1; // Fix root flag.
-    }
+  for (size_t v = 0; v != num_v; ++v)
     if (is_articulation[v])
       output_articulation_point(v);
-  }
 }
 
 } // end namespace cpl
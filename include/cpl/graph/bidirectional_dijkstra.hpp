@@ -0,0 +1,163 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the bidirectional Dijkstra's algorithm.
+
+#ifndef CPL_GRAPH_BIDIRECTIONAL_DIJKSTRA_HPP
+#define CPL_GRAPH_BIDIRECTIONAL_DIJKSTRA_HPP
+
+#include <cpl/data_structure/indexed_dary_heap.hpp> // indexed_dary_heap
+#include <algorithm>                                // copy, reverse
+#include <cstddef>                                  // size_t
+#include <iterator>                                 // back_inserter
+#include <limits>                                   // numeric_limits
+#include <vector>                                   // vector
+
+namespace cpl {
+
+namespace detail {
+
+template <class Graph, class Distance>
+struct bidirectional_search {
+  using index_type = typename Graph::index_type;
+
+  std::vector<Distance> dist[2];   // Forward and backward distances.
+  std::vector<index_type> pred[2]; // Edge used to reach each vertex.
+  Distance best;                   // Length of the best path found.
+  index_type meet_edge;            // Edge joining both searches on it.
+
+  bidirectional_search(const Graph& g, const size_t s, const size_t t,
+                       const std::vector<Distance>& weight) {
+    const size_t num_v = g.num_vertices();
+    const auto inf = std::numeric_limits<Distance>::max();
+    const auto nil = std::numeric_limits<index_type>::max();
+    indexed_dary_heap<Distance> heap[2];
+    for (int dir = 0; dir != 2; ++dir) {
+      dist[dir].assign(num_v, inf);
+      pred[dir].assign(num_v, nil);
+      heap[dir].resize(num_v);
+    }
+
+    dist[0][s] = dist[1][t] = 0;
+    heap[0].push(s, 0);
+    heap[1].push(t, 0);
+    best = (s == t) ? 0 : inf;
+    meet_edge = nil;
+
+    // Direction 0 follows out-edges from s, direction 1 in-edges from t.
+    while (!heap[0].empty() && !heap[1].empty() &&
+           heap[0].top_key() + heap[1].top_key() < best) {
+      const int dir = heap[0].top_key() <= heap[1].top_key() ? 0 : 1;
+      const auto u = static_cast<index_type>(heap[dir].top());
+      heap[dir].pop();
+
+      const auto& edges = dir == 0 ? g.out_edges(u) : g.in_edges(u);
+      for (const auto edge : edges) {
+        const index_type v = dir == 0 ? g.target(edge) : g.source(edge);
+        const Distance alt = dist[dir][u] + weight[edge]; // alternative
+        if (alt < dist[dir][v]) {
+          dist[dir][v] = alt;
+          pred[dir][v] = edge;
+          heap[dir].push_or_decrease(v, alt);
+        }
+        if (dist[1 - dir][v] != inf && alt + dist[1 - dir][v] < best) {
+          best = alt + dist[1 - dir][v];
+          meet_edge = edge;
+        }
+      }
+    }
+  }
+
+  // Writes the vertices of the path from 'from' to the root of the search
+  // 'dir', excluding 'from'.
+  template <typename OutputIt>
+  OutputIt write_branch(const Graph& g, size_t from, const int dir,
+                        OutputIt out_it) const {
+    const auto nil = std::numeric_limits<index_type>::max();
+    while (pred[dir][from] != nil) {
+      const index_type e = pred[dir][from];
+      from = dir == 0 ? g.source(e) : g.target(e);
+      *out_it++ = from;
+    }
+    return out_it;
+  }
+};
+
+} // end namespace detail
+
+/// \brief Finds the shortest distance between two vertices.
+///
+/// Runs two Dijkstra's searches at the same time: one forward from \p s
+/// and one backward from \p t through in-edges, stopping as soon as the sum
+/// of the minimum keys of both queues reaches the best path found. Vertices
+/// far away from both endpoints are never settled.
+///
+/// \param g The target directed graph. It must provide \c in_edges.
+/// \param s The source vertex.
+/// \param t The target vertex.
+/// \param weight Weight map of edges.
+///
+/// \returns The shortest distance from \p s to \p t, or
+/// <tt>std::numeric_limits<Distance>::max()</tt> if \p t is not reachable
+/// from \p s.
+///
+/// \pre All weights must be non-negative.
+///
+/// \par Complexity
+/// <tt>O(E * log(V))</tt> in the worst case.
+///
+/// \sa dijkstra_shortest_paths, astar_shortest_path
+///
+template <class Graph, class Distance>
+Distance bidirectional_dijkstra(const Graph& g, const size_t s, const size_t t,
+                                const std::vector<Distance>& weight) {
+  return detail::bidirectional_search<Graph, Distance>(g, s, t, weight).best;
+}
+
+/// \brief Finds a shortest path between two vertices.
+///
+/// \param g The target directed graph. It must provide \c in_edges.
+/// \param s The source vertex.
+/// \param t The target vertex.
+/// \param weight Weight map of edges.
+/// \param out_it Beginning of the destination range. The vertices of a
+/// shortest path from \p s to \p t are copied to this range, in order. Nothing
+/// is copied if \p t is not reachable from \p s.
+///
+/// \returns The shortest distance from \p s to \p t, or
+/// <tt>std::numeric_limits<Distance>::max()</tt> if \p t is not reachable
+/// from \p s.
+///
+/// \pre All weights must be non-negative.
+///
+/// \par Complexity
+/// <tt>O(E * log(V))</tt> in the worst case.
+///
+template <class Graph, class Distance, class OutputIt>
+Distance bidirectional_dijkstra(const Graph& g, const size_t s, const size_t t,
+                                const std::vector<Distance>& weight,
+                                OutputIt out_it) {
+  const detail::bidirectional_search<Graph, Distance> search(g, s, t, weight);
+  if (search.best == std::numeric_limits<Distance>::max())
+    return search.best;
+  if (s == t) {
+    *out_it++ = s;
+    return search.best;
+  }
+
+  using index_type = typename Graph::index_type;
+  const index_type e = search.meet_edge;
+  std::vector<index_type> path = {g.source(e)};
+  search.write_branch(g, g.source(e), 0, std::back_inserter(path));
+  std::reverse(path.begin(), path.end());
+  path.push_back(g.target(e));
+  search.write_branch(g, g.target(e), 1, std::back_inserter(path));
+  std::copy(path.begin(), path.end(), out_it);
+  return search.best;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
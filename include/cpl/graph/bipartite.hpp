@@ -6,13 +6,39 @@
 #ifndef CPL_GRAPH_BIPARTITE_HPP
 #define CPL_GRAPH_BIPARTITE_HPP
 
-#include <cassert>    // assert
-#include <cstddef>    // size_t
-#include <functional> // function
-#include <vector>     // vector
+#include <cpl/graph/depth_first_search.hpp> // depth_first_search
+#include <cstddef>                           // size_t
+#include <vector>                            // vector
 
 namespace cpl {
 
+namespace detail {
+
+class bipartite_visitor : public dfs_visitor {
+public:
+  explicit bipartite_visitor(std::vector<bool>& color_) : color(color_) {}
+
+  void tree_edge(size_t, const size_t u, const size_t v) {
+    color[v] = !color[u];
+  }
+  void back_edge(size_t, const size_t u, const size_t v) {
+    if (color[u] == color[v])
+      odd_cycle_found = true;
+  }
+  void forward_or_cross_edge(size_t e, size_t u, size_t v) {
+    back_edge(e, u, v);
+  }
+  bool done() const {
+    return odd_cycle_found;
+  }
+
+private:
+  std::vector<bool>& color;
+  bool odd_cycle_found = false;
+};
+
+} // end namespace detail
+
 /// \brief Checks if an undirected graph is bipartite.
 ///
 /// An undirected graph is bipartite if it can be partitioned into two groups of
@@ -32,35 +58,9 @@ namespace cpl {
 ///
 template <typename Graph>
 bool is_bipartite(const Graph& g, std::vector<bool>& color) {
-  const size_t num_v = g.num_vertices();
-  std::vector<bool> visited(num_v);
-  color.resize(num_v);
-
-  std::function<bool(size_t)> dfs_visit;
-  dfs_visit = [&](const size_t src) -> bool {
-    assert(!visited[src]);
-    visited[src] = true;
-    for (const auto e : g.out_edges(src)) {
-      const size_t tgt = (src == g.source(e)) ? g.target(e) : g.source(e);
-      if (visited[tgt]) {
-        if (color[src] == color[tgt])
-          return false;
-        continue;
-      }
-      color[tgt] = !color[src];
-      if (!dfs_visit(tgt))
-        return false;
-    }
-    return true;
-  };
-
-  for (size_t v = 0; v != num_v; ++v) {
-    if (visited[v])
-      continue;
-    if (!dfs_visit(v))
-      return false;
-  }
-  return true;
+  color.resize(g.num_vertices());
+  detail::bipartite_visitor vis(color);
+  return depth_first_search(g, vis);
 }
 
 } // end namespace cpl
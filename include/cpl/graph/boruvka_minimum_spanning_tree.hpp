@@ -0,0 +1,128 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the Boruvka's minimum spanning tree algorithm.
+
+#ifndef CPL_GRAPH_BORUVKA_MINIMUM_SPANNING_TREE_HPP
+#define CPL_GRAPH_BORUVKA_MINIMUM_SPANNING_TREE_HPP
+
+#include <cpl/data_structure/disjoint_set.hpp> // disjoint_set
+#include <cpl/utility/parallel.hpp>            // parallel_for
+#include <algorithm>                           // max, sort, remove_if
+#include <cstddef>                             // size_t
+#include <limits>                              // numeric_limits
+#include <numeric>                             // iota
+#include <vector>                              // vector
+
+namespace cpl {
+
+/// \brief Finds a minimum spanning tree (MST) in an undirected graph with
+/// weighted edges using the Boruvka's algorithm.
+///
+/// Works in rounds. In each round, the lightest edge leaving each tree of
+/// the forest is found with a single pass over the remaining edges, and all
+/// of them are added at once. Every round at least halves the number of
+/// trees. Edges inside a tree are dropped between rounds.
+///
+/// The pass over the edges is split among \p num_threads threads. Each one
+/// finds the lightest edges of its own chunk, and the candidates of all the
+/// chunks are then merged. The trees are looked up once per round before the
+/// pass, so the threads only read shared data.
+///
+/// Ties between equal weights are broken by the edge index, which prevents
+/// cycles and makes the result the same as the one of
+/// \c filter_kruskal_minimum_spanning_tree.
+///
+/// \param g The target graph.
+/// \param weight The weight map of edges.
+/// \param num_threads The number of threads to use.
+///
+/// \returns A <tt>std::vector</tt> containing the edge descriptors of the MST
+/// sorted by weight.
+///
+/// \par Complexity
+/// <tt>O(E * log(V) + V * T)</tt>, where \c T is the number of threads.
+///
+/// \sa kruskal_minimum_spanning_tree
+///
+template <typename Graph, typename Weight>
+std::vector<typename Graph::index_type>
+boruvka_minimum_spanning_tree(const Graph& g, const std::vector<Weight>& weight,
+                              const size_t num_threads = 1) {
+  using index_type = typename Graph::index_type;
+  const size_t num_vertices = g.num_vertices();
+  const auto nil = std::numeric_limits<index_type>::max();
+  auto edge_less = [&](const index_type lhs, const index_type rhs) {
+    return weight[lhs] < weight[rhs] ||
+           (!(weight[rhs] < weight[lhs]) && lhs < rhs);
+  };
+
+  std::vector<index_type> edges(g.num_edges());
+  std::iota(edges.begin(), edges.end(), index_type{0});
+
+  disjoint_set dset(num_vertices);
+  std::vector<index_type> tree_edges;
+  std::vector<index_type> tree_of(num_vertices); // Root of each vertex.
+  // Lightest edge of each tree root, and roots with one, for each chunk.
+  const size_t max_chunks = std::max(num_threads, size_t{1});
+  std::vector<std::vector<index_type>> lightest(
+      max_chunks, std::vector<index_type>(num_vertices, nil));
+  std::vector<std::vector<index_type>> roots(max_chunks);
+
+  // Offers 'e' as the lightest edge of the tree 'root' in the given chunk.
+  auto offer = [&](const size_t chunk, const index_type root,
+                   const index_type e) {
+    auto& best = lightest[chunk][root];
+    if (best == nil)
+      roots[chunk].push_back(root);
+    if (best == nil || edge_less(e, best))
+      best = e;
+  };
+
+  while (true) {
+    for (size_t v = 0; v != num_vertices; ++v)
+      tree_of[v] = static_cast<index_type>(dset.find_set(v));
+    edges.erase(std::remove_if(edges.begin(), edges.end(),
+                               [&](const index_type e) {
+                                 return tree_of[g.source(e)] ==
+                                        tree_of[g.target(e)];
+                               }),
+                edges.end());
+    if (edges.empty())
+      break;
+
+    auto scan = [&](const size_t chunk, const size_t first, const size_t last) {
+      for (size_t i = first; i != last; ++i) {
+        const index_type e = edges[i];
+        offer(chunk, tree_of[g.source(e)], e);
+        offer(chunk, tree_of[g.target(e)], e);
+      }
+    };
+    parallel_for(edges.size(), num_threads, scan);
+    for (size_t chunk = 1; chunk != max_chunks; ++chunk) {
+      for (const index_type root : roots[chunk]) {
+        offer(0, root, lightest[chunk][root]);
+        lightest[chunk][root] = nil;
+      }
+      roots[chunk].clear();
+    }
+
+    // The same edge may be the lightest for both of its trees.
+    for (const index_type root : roots[0]) {
+      const index_type e = lightest[0][root];
+      if (dset.union_set(g.source(e), g.target(e)))
+        tree_edges.push_back(e);
+      lightest[0][root] = nil;
+    }
+    roots[0].clear();
+  }
+
+  std::sort(tree_edges.begin(), tree_edges.end(), edge_less);
+  return tree_edges;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
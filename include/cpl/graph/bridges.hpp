@@ -6,13 +6,51 @@
 #ifndef CPL_GRAPH_BRIDGES_HPP
 #define CPL_GRAPH_BRIDGES_HPP
 
-#include <algorithm>  // min
-#include <cstddef>    // size_t
-#include <functional> // function
-#include <vector>     // vector
+#include <cpl/graph/depth_first_search.hpp> // depth_first_search
+#include <algorithm>                         // min
+#include <cstddef>                           // size_t
+#include <limits>                            // numeric_limits
+#include <vector>                            // vector
 
 namespace cpl {
 
+namespace detail {
+
+template <typename Graph, typename UnaryFunction>
+class bridges_visitor : public dfs_visitor {
+  using index_type = typename Graph::index_type;
+
+public:
+  bridges_visitor(const size_t num_vertices, UnaryFunction& output_bridge_)
+      : pred(num_vertices, std::numeric_limits<index_type>::max()),
+        dtm(num_vertices), low(num_vertices), output_bridge(output_bridge_) {}
+
+  void discover_vertex(const index_type v) {
+    low[v] = dtm[v] = ++time;
+  }
+  void tree_edge(index_type, const index_type u, const index_type v) {
+    pred[v] = u;
+  }
+  void back_edge(index_type, const index_type u, const index_type v) {
+    if (v != pred[u])
+      low[u] = std::min(low[u], dtm[v]);
+  }
+  void finish_edge(const index_type e, const index_type u, const index_type v) {
+    low[u] = std::min(low[u], low[v]);
+    if (low[v] > dtm[u])
+      output_bridge(e);
+  }
+
+private:
+  index_type time = 0;
+  std::vector<index_type> pred;
+  std::vector<index_type> dtm;
+  std::vector<index_type> low;
+  UnaryFunction& output_bridge;
+};
+
+} // end namespace detail
+
 /// \brief Finds the bridges of the given simple graph.
 ///
 /// Uses the Tarjan's algorithm to find the bridges of the graph \c g. An edge
@@ -37,31 +75,9 @@ namespace cpl {
 template <typename Graph, typename UnaryFunction>
 void find_bridges(const Graph& g, UnaryFunction output_bridge) {
 
-  const size_t num_v = g.num_vertices();
-  size_t time = 0;
-  std::vector<size_t> pred(num_v, SIZE_MAX);
-  std::vector<size_t> dtm(num_v);
-  std::vector<size_t> low(num_v);
-
-  std::function<void(size_t)> dfs_visit;
-  dfs_visit = [&](const size_t src) {
-    low[src] = dtm[src] = ++time;
-    for (const auto e : g.out_edges(src)) {
-      const size_t tgt = (src == g.source(e)) ? g.target(e) : g.source(e);
-      if (!dtm[tgt]) {
-        pred[tgt] = src;
-        dfs_visit(tgt);
-        low[src] = std::min(low[src], low[tgt]);
-        if (low[tgt] > dtm[src])
-          output_bridge(e);
-      } else if (tgt != pred[src])
-        low[src] = std::min(low[src], dtm[tgt]);
-    }
-  };
-
-  for (size_t v = 0; v != num_v; ++v)
-    if (!dtm[v])
-      dfs_visit(v);
+  detail::bridges_visitor<Graph, UnaryFunction> vis(g.num_vertices(),
+                                                    output_bridge);
+  depth_first_search(g, vis);
 }
 
 } // end namespace cpl
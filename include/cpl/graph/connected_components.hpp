@@ -6,9 +6,12 @@
 #ifndef CPL_GRAPH_CONNECTED_COMPONENTS_HPP
 #define CPL_GRAPH_CONNECTED_COMPONENTS_HPP
 
-#include <cstddef> // size_t
-#include <cstdint> // SIZE_MAX
-#include <vector>  // vector
+#include <cpl/data_structure/concurrent_disjoint_set.hpp> // concurrent_disjoint_set
+#include <cpl/utility/parallel.hpp>                      // parallel_for
+#include <cstddef>                                       // size_t
+#include <limits>                                        // numeric_limits
+#include <numeric>                                       // iota
+#include <vector>                                        // vector
 
 namespace cpl {
 
@@ -36,13 +39,17 @@ namespace cpl {
 /// \par Complexity
 /// <tt>O(V + E)</tt>.
 ///
-template <typename Graph>
-size_t connected_components(const Graph& g, std::vector<size_t>& component_of) {
+/// \sa union_find_connected_components
+///
+template <typename Graph, typename Label>
+size_t connected_components(const Graph& g, std::vector<Label>& component_of) {
+  using index_type = typename Graph::index_type;
   const size_t num_vertices = g.num_vertices();
-  component_of.assign(num_vertices, SIZE_MAX);
+  const auto undiscovered = std::numeric_limits<Label>::max();
+  component_of.assign(num_vertices, undiscovered);
 
-  std::vector<size_t> stack;
-  auto explore = [&](const size_t source, const size_t comp_label) {
+  std::vector<index_type> stack;
+  auto explore = [&](const index_type source, const Label comp_label) {
     component_of[source] = comp_label;
     stack.push_back(source);
     while (!stack.empty()) {
@@ -50,7 +57,7 @@ size_t connected_components(const Graph& g, std::vector<size_t>& component_of) {
       stack.pop_back();
       for (const auto e : g.out_edges(u)) {
         const auto v = (u == g.source(e)) ? g.target(e) : g.source(e);
-        if (component_of[v] != SIZE_MAX)
+        if (component_of[v] != undiscovered)
           continue; // It has been discovered before.
         component_of[v] = comp_label;
         stack.push_back(v);
@@ -60,9 +67,117 @@ size_t connected_components(const Graph& g, std::vector<size_t>& component_of) {
 
   size_t num_components = 0;
   for (size_t v = 0; v != num_vertices; ++v)
-    if (component_of[v] == SIZE_MAX)
-      explore(v, num_components++);
+    if (component_of[v] == undiscovered)
+      explore(static_cast<index_type>(v),
+              static_cast<Label>(num_components++));
+
+  return num_components;
+}
+
+/// \brief Computes the connected components of an undirected graph using a
+/// union-find approach.
+///
+/// The edges are scanned in index order and the trees of their endpoints are
+/// linked, always hanging the root with the larger index from the smaller
+/// one, with path halving on every find. Adjacency lists are never walked,
+/// so the scan is sequential over the edge list. Since each root is the
+/// smallest vertex of its component, the final labeling pass yields exactly
+/// the same labels as \c connected_components.
+///
+/// \param g The target graph.
+/// \param[out] component_of Map vector where the component label of each vertex
+/// is recorded, with the same meaning as in \c connected_components.
+///
+/// \returns The total number of components.
+///
+/// \par Complexity
+/// <tt>O(V + E * log(V))</tt>.
+///
+/// \sa union_find_connected_components(const Graph&, std::vector<Label>&,
+/// size_t)
+///
+template <typename Graph, typename Label>
+size_t union_find_connected_components(const Graph& g,
+                                       std::vector<Label>& component_of) {
+  using index_type = typename Graph::index_type;
+  const size_t num_vertices = g.num_vertices();
+  const size_t num_edges = g.num_edges();
+
+  std::vector<index_type> parent(num_vertices);
+  std::iota(parent.begin(), parent.end(), index_type{0});
+  auto find_root = [&](index_type v) {
+    while (parent[v] != v) {
+      parent[v] = parent[parent[v]]; // Path halving
+      v = parent[v];
+    }
+    return v;
+  };
 
+  for (size_t e = 0; e != num_edges; ++e) {
+    const auto edge = static_cast<index_type>(e);
+    const index_type a = find_root(g.source(edge));
+    const index_type b = find_root(g.target(edge));
+    if (a < b)
+      parent[b] = a;
+    else if (b < a)
+      parent[a] = b;
+  }
+
+  // The root of each vertex is not greater than it, so it is labeled first.
+  component_of.resize(num_vertices);
+  size_t num_components = 0;
+  for (size_t v = 0; v != num_vertices; ++v) {
+    const index_type root = find_root(static_cast<index_type>(v));
+    component_of[v] = root == v ? static_cast<Label>(num_components++)
+                                : component_of[root];
+  }
+  return num_components;
+}
+
+/// \brief Computes the connected components of an undirected graph using a
+/// union-find approach on several threads.
+///
+/// The edge list is split into chunks of consecutive edges, and each chunk
+/// is scanned by its own thread, which links the trees of the endpoints in a
+/// shared \c concurrent_disjoint_set. That set also hangs the root with the
+/// larger index from the smaller one, so the labeling pass that follows,
+/// made by the calling thread, gives the same labels as the sequential
+/// overload and \c connected_components.
+///
+/// \param g The target graph.
+/// \param[out] component_of Map vector where the component label of each vertex
+/// is recorded, with the same meaning as in \c connected_components.
+/// \param num_threads The number of threads to use.
+///
+/// \returns The total number of components.
+///
+/// \par Complexity
+/// <tt>O(V + E * log(V))</tt> work, of which the edge scan is divided among
+/// the threads.
+///
+template <typename Graph, typename Label>
+size_t union_find_connected_components(const Graph& g,
+                                       std::vector<Label>& component_of,
+                                       const size_t num_threads) {
+  using index_type = typename Graph::index_type;
+  const size_t num_vertices = g.num_vertices();
+
+  concurrent_disjoint_set dset(num_vertices);
+  parallel_for(g.num_edges(), num_threads,
+               [&](size_t, const size_t first, const size_t last) {
+                 for (size_t e = first; e != last; ++e) {
+                   const auto edge = static_cast<index_type>(e);
+                   dset.union_set(g.source(edge), g.target(edge));
+                 }
+               });
+
+  component_of.resize(num_vertices);
+  size_t num_components = 0;
+  for (size_t v = 0; v != num_vertices; ++v) {
+    const size_t root = dset.find_set(v);
+    component_of[v] = root == v ? static_cast<Label>(num_components++)
+                                : component_of[root];
+  }
   return num_components;
 }
 
@@ -0,0 +1,414 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Defines the class \c contraction_hierarchy.
+
+#ifndef CPL_GRAPH_CONTRACTION_HIERARCHY_HPP
+#define CPL_GRAPH_CONTRACTION_HIERARCHY_HPP
+
+#include <cpl/data_structure/indexed_dary_heap.hpp> // indexed_dary_heap
+#include <algorithm>                                // reverse
+#include <cstddef>                                  // size_t
+#include <limits>                                   // numeric_limits
+#include <type_traits> // is_integral, is_unsigned
+#include <vector>      // vector
+
+namespace cpl {
+
+/// \brief Preprocessed graph which answers point-to-point shortest path
+/// queries by exploring a small part of it.
+///
+/// Vertices are contracted one by one in order of importance. When a vertex
+/// \c v is contracted, a shortcut <tt>(u, w)</tt> is added for every pair of
+/// remaining neighbors whose only shortest path is <tt>u -> v -> w</tt>. The
+/// position of a vertex in the contraction order is its rank. Every shortest
+/// path then has a counterpart which first climbs and then descends in rank,
+/// so queries run two Dijkstra's searches which only follow edges towards
+/// higher ranks.
+///
+/// Shortcuts remember the two edges they replace, so paths can be unpacked
+/// into paths of the original graph.
+///
+/// \tparam Distance Distance type.
+/// \tparam Index Unsigned integer type used to store vertex and edge
+/// descriptors.
+///
+template <typename Distance, typename Index = size_t>
+class contraction_hierarchy {
+  static_assert(std::is_integral<Index>::value &&
+                    std::is_unsigned<Index>::value,
+                "'Index' must be an unsigned integer type.");
+
+public:
+  using index_type = Index;
+
+private:
+  // Edges of the augmented graph. Shortcuts refer to the edges they replace.
+  struct arc {
+    index_type tail;
+    index_type head;
+    Distance weight;
+    index_type first, second; // nil for edges of the original graph.
+  };
+
+  // Entry of the adjacency lists used during the contraction.
+  struct link {
+    index_type vertex;
+    index_type arc_id;
+  };
+
+  static index_type nil() {
+    return std::numeric_limits<index_type>::max();
+  }
+  static Distance inf() {
+    return std::numeric_limits<Distance>::max();
+  }
+
+public:
+  /// \brief Contracts all the vertices of the given graph.
+  ///
+  /// \param g The target directed graph.
+  /// \param weight Weight map of edges.
+  ///
+  /// \pre All weights must be non-negative.
+  ///
+  /// \par Complexity
+  /// Depends on the structure of the graph. Road-like graphs produce few
+  /// shortcuts and are preprocessed in near-linear time.
+  ///
+  template <class Graph>
+  contraction_hierarchy(const Graph& g, const std::vector<Distance>& weight) {
+    const size_t num_v = g.num_vertices();
+    out_links.resize(num_v);
+    in_links.resize(num_v);
+    for (size_t e = 0; e != g.num_edges(); ++e)
+      if (g.source(e) != g.target(e))
+        add_arc(g.source(e), g.target(e), weight[e], nil(), nil());
+
+    wdist.assign(num_v, inf());
+    wheap.resize(num_v);
+    contract_all();
+
+    for (int dir = 0; dir != 2; ++dir) {
+      qdist[dir].assign(num_v, inf());
+      qpred[dir].assign(num_v, nil());
+      qheap[dir].resize(num_v);
+    }
+    // The contraction workspace is no longer needed.
+    out_links = std::vector<std::vector<link>>();
+    in_links = std::vector<std::vector<link>>();
+    deleted_neighbors = std::vector<size_t>();
+    wdist = std::vector<Distance>();
+    wtouched = std::vector<index_type>();
+    wheap = indexed_dary_heap<Distance>();
+  }
+
+  /// \brief Returns the number of vertices.
+  size_t num_vertices() const {
+    return ranks.size();
+  }
+
+  /// \brief Returns the number of shortcuts added by the preprocessing that
+  /// are still links of the hierarchy, not counting superseded ones.
+  size_t num_shortcuts() const {
+    return num_shortcut_arcs;
+  }
+
+  /// \brief Returns the position of \p v in the contraction order.
+  size_t rank(const size_t v) const {
+    return ranks[v];
+  }
+
+  /// \brief Finds the shortest distance from \p s to \p t.
+  ///
+  /// \returns The shortest distance, or
+  /// <tt>std::numeric_limits<Distance>::max()</tt> if \p t is not reachable
+  /// from \p s.
+  ///
+  /// \par Complexity
+  /// Proportional to the number of vertices of higher rank reachable from
+  /// \p s and \p t, which is usually a tiny fraction of the graph.
+  ///
+  Distance distance(const size_t s, const size_t t) {
+    return search(s, t);
+  }
+
+  /// \brief Finds a shortest path from \p s to \p t.
+  ///
+  /// \param s The source vertex.
+  /// \param t The target vertex.
+  /// \param out_it Beginning of the destination range. The vertices of a
+  /// shortest path of the original graph are copied to this range, in order.
+  /// Nothing is copied if \p t is not reachable from \p s.
+  ///
+  /// \returns The shortest distance, or
+  /// <tt>std::numeric_limits<Distance>::max()</tt> if \p t is not reachable
+  /// from \p s.
+  ///
+  template <typename OutputIt>
+  Distance shortest_path(const size_t s, const size_t t, OutputIt out_it) {
+    const Distance dist = search(s, t);
+    if (dist == inf())
+      return dist;
+
+    // Collect the arcs from s to meet, and then the arcs from meet to t.
+    std::vector<index_type> path_arcs;
+    for (index_type v = meet; qpred[0][v] != nil(); v = arcs[qpred[0][v]].tail)
+      path_arcs.push_back(qpred[0][v]);
+    std::reverse(path_arcs.begin(), path_arcs.end());
+    for (index_type v = meet; qpred[1][v] != nil(); v = arcs[qpred[1][v]].head)
+      path_arcs.push_back(qpred[1][v]);
+
+    *out_it++ = s;
+    std::vector<index_type> stack;
+    for (const index_type a : path_arcs) {
+      stack.push_back(a);
+      while (!stack.empty()) {
+        const arc& curr = arcs[stack.back()];
+        stack.pop_back();
+        if (curr.first == nil()) {
+          *out_it++ = curr.head;
+        } else {
+          stack.push_back(curr.second);
+          stack.push_back(curr.first);
+        }
+      }
+    }
+    return dist;
+  }
+
+private:
+  // Adds the arc (u, v) unless there is already one with lower weight.
+  void add_arc(const size_t u, const size_t v, const Distance w,
+               const index_type first, const index_type second) {
+    for (auto& out : out_links[u]) {
+      if (out.vertex != v)
+        continue;
+      if (arcs[out.arc_id].weight <= w)
+        return;
+      // The superseded arc stays in place for unpacking, but is no longer
+      // a link of the hierarchy.
+      num_shortcut_arcs -= arcs[out.arc_id].first != nil();
+      out.arc_id = new_arc(u, v, w, first, second);
+      for (auto& in : in_links[v])
+        if (in.vertex == u)
+          in.arc_id = out.arc_id;
+      return;
+    }
+    const index_type id = new_arc(u, v, w, first, second);
+    out_links[u].push_back({static_cast<index_type>(v), id});
+    in_links[v].push_back({static_cast<index_type>(u), id});
+  }
+
+  index_type new_arc(const size_t u, const size_t v, const Distance w,
+                     const index_type first, const index_type second) {
+    arcs.push_back({static_cast<index_type>(u), static_cast<index_type>(v), w,
+                    first, second});
+    num_shortcut_arcs += first != nil();
+    return static_cast<index_type>(arcs.size() - 1);
+  }
+
+  // Dijkstra's search from u over the remaining graph without v. It gives up
+  // after settling a few vertices, which can only add redundant shortcuts.
+  void witness_search(const size_t u, const size_t v, const Distance limit) {
+    const size_t max_settled = 64;
+    for (const index_type x : wtouched)
+      wdist[x] = inf();
+    wtouched.assign(1, static_cast<index_type>(u));
+    wdist[u] = 0;
+    wheap.push(u, 0);
+
+    for (size_t settled = 0; !wheap.empty() && settled != max_settled;
+         ++settled) {
+      const size_t x = wheap.top();
+      if (wheap.top_key() > limit)
+        break;
+      wheap.pop();
+      for (const auto& out : out_links[x]) {
+        if (out.vertex == v)
+          continue;
+        const Distance alt = wdist[x] + arcs[out.arc_id].weight;
+        if (alt >= wdist[out.vertex])
+          continue;
+        if (wdist[out.vertex] == inf())
+          wtouched.push_back(out.vertex);
+        wdist[out.vertex] = alt;
+        wheap.push_or_decrease(out.vertex, alt);
+      }
+    }
+    wheap.clear();
+  }
+
+  // Returns the number of shortcuts needed to contract v, adding them unless
+  // 'simulate' is set.
+  size_t contract(const size_t v, const bool simulate) {
+    size_t count = 0;
+    for (const auto& in : in_links[v]) {
+      const Distance w1 = arcs[in.arc_id].weight;
+      Distance limit = 0;
+      bool any_target = false;
+      for (const auto& out : out_links[v]) {
+        if (out.vertex == in.vertex)
+          continue;
+        any_target = true;
+        if (w1 + arcs[out.arc_id].weight > limit)
+          limit = w1 + arcs[out.arc_id].weight;
+      }
+      if (!any_target)
+        continue;
+
+      witness_search(in.vertex, v, limit);
+      for (const auto& out : out_links[v]) {
+        const Distance via = w1 + arcs[out.arc_id].weight;
+        if (out.vertex == in.vertex || wdist[out.vertex] <= via)
+          continue;
+        ++count;
+        if (!simulate)
+          add_arc(in.vertex, out.vertex, via, in.arc_id, out.arc_id);
+      }
+    }
+    return count;
+  }
+
+  // Edge difference heuristic: prefers vertices whose contraction removes
+  // more edges than it adds, spread over the graph.
+  long long priority(const size_t v) {
+    const size_t added = contract(v, true);
+    return static_cast<long long>(added) -
+           static_cast<long long>(in_links[v].size() + out_links[v].size()) +
+           static_cast<long long>(deleted_neighbors[v]);
+  }
+
+  void contract_all() {
+    const size_t num_v = out_links.size();
+    ranks.assign(num_v, 0);
+    deleted_neighbors.assign(num_v, 0);
+    up_offset.assign(1, 0);
+    down_offset.assign(1, 0);
+    size_t next_rank = 0;
+
+    indexed_dary_heap<long long> order(num_v);
+    for (size_t v = 0; v != num_v; ++v)
+      order.push(v, priority(v));
+
+    while (!order.empty()) {
+      // Priorities are updated lazily, when the vertex reaches the top.
+      const size_t v = order.top();
+      order.pop();
+      const long long prio = priority(v);
+      if (!order.empty() && prio > order.top_key()) {
+        order.push(v, prio);
+        continue;
+      }
+
+      contract(v, false);
+      ranks[v] = static_cast<index_type>(next_rank++);
+      for (const auto& out : out_links[v]) {
+        up_arcs.push_back(out.arc_id);
+        unlink(in_links[out.vertex], v);
+        ++deleted_neighbors[out.vertex];
+      }
+      for (const auto& in : in_links[v]) {
+        down_arcs.push_back(in.arc_id);
+        unlink(out_links[in.vertex], v);
+        ++deleted_neighbors[in.vertex];
+      }
+      up_offset.push_back(up_arcs.size());
+      down_offset.push_back(down_arcs.size());
+      out_links[v] = std::vector<link>();
+      in_links[v] = std::vector<link>();
+    }
+  }
+
+  static void unlink(std::vector<link>& links, const size_t v) {
+    for (size_t i = 0; i != links.size(); ++i) {
+      if (links[i].vertex == v) {
+        links[i] = links.back();
+        links.pop_back();
+        return;
+      }
+    }
+  }
+
+  // Bidirectional search over the upward arcs. Stores in 'meet' the vertex
+  // with highest rank in the path found.
+  Distance search(const size_t s, const size_t t) {
+    for (int dir = 0; dir != 2; ++dir) {
+      for (const index_type v : qtouched[dir]) {
+        qdist[dir][v] = inf();
+        qpred[dir][v] = nil();
+      }
+      qtouched[dir].assign(1, static_cast<index_type>(dir == 0 ? s : t));
+    }
+    qdist[0][s] = qdist[1][t] = 0;
+    qheap[0].push(s, 0);
+    qheap[1].push(t, 0);
+
+    Distance best = inf();
+    meet = nil();
+    while (!qheap[0].empty() || !qheap[1].empty()) {
+      int dir = 0;
+      if (qheap[0].empty() ||
+          (!qheap[1].empty() && qheap[1].top_key() < qheap[0].top_key()))
+        dir = 1;
+      if (qheap[dir].top_key() >= best) {
+        qheap[dir].clear(); // Nothing better can be found in this direction.
+        continue;
+      }
+
+      const size_t u = qheap[dir].top();
+      qheap[dir].pop();
+      if (qdist[1 - dir][u] != inf() &&
+          qdist[dir][u] + qdist[1 - dir][u] < best) {
+        best = qdist[dir][u] + qdist[1 - dir][u];
+        meet = static_cast<index_type>(u);
+      }
+
+      const auto& offset = dir == 0 ? up_offset : down_offset;
+      const auto& adj = dir == 0 ? up_arcs : down_arcs;
+      for (size_t i = offset[ranks[u]]; i != offset[ranks[u] + 1]; ++i) {
+        const arc& a = arcs[adj[i]];
+        const index_type v = dir == 0 ? a.head : a.tail;
+        const Distance alt = qdist[dir][u] + a.weight;
+        if (alt >= qdist[dir][v])
+          continue;
+        if (qdist[dir][v] == inf())
+          qtouched[dir].push_back(v);
+        qdist[dir][v] = alt;
+        qpred[dir][v] = adj[i];
+        qheap[dir].push_or_decrease(v, alt);
+      }
+    }
+    return best;
+  }
+
+  std::vector<arc> arcs;
+  size_t num_shortcut_arcs = 0;
+
+  // Result of the contraction. Arcs leaving the vertex of rank r towards
+  // higher ranks are in [up_offset[r], up_offset[r + 1]) of 'up_arcs', and
+  // arcs entering it from higher ranks are stored likewise in 'down_arcs'.
+  std::vector<index_type> ranks;
+  std::vector<size_t> up_offset, down_offset;
+  std::vector<index_type> up_arcs, down_arcs;
+
+  // Contraction workspace.
+  std::vector<std::vector<link>> out_links, in_links;
+  std::vector<size_t> deleted_neighbors;
+  std::vector<Distance> wdist;
+  std::vector<index_type> wtouched;
+  indexed_dary_heap<Distance> wheap;
+
+  // Query workspace.
+  std::vector<Distance> qdist[2];
+  std::vector<index_type> qpred[2];
+  std::vector<index_type> qtouched[2];
+  indexed_dary_heap<Distance> qheap[2];
+  index_type meet;
+};
+
+} // end namespace cpl
+
+#endif // Header guard
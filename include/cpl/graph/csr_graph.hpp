@@ -0,0 +1,274 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Defines immutable graphs stored in the compressed sparse row format.
+
+#ifndef CPL_GRAPH_CSR_GRAPH_HPP
+#define CPL_GRAPH_CSR_GRAPH_HPP
+
+#include <cstddef>     // size_t
+#include <type_traits> // is_integral, is_unsigned
+#include <utility>     // pair, move
+#include <vector>      // vector
+
+namespace cpl {
+
+/// \brief Read-only view of a contiguous sequence of edge descriptors.
+///
+template <typename Index>
+class csr_edge_range {
+  const Index* first;
+  const Index* last;
+
+public:
+  csr_edge_range(const Index* first_, const Index* last_)
+      : first{first_}, last{last_} {}
+
+  const Index* begin() const {
+    return first;
+  }
+  const Index* end() const {
+    return last;
+  }
+  size_t size() const {
+    return static_cast<size_t>(last - first);
+  }
+  bool empty() const {
+    return first == last;
+  }
+};
+
+namespace detail {
+
+/// \brief Builds the offset and edge arrays of a CSR adjacency structure.
+///
+/// Places the edges in buckets indexed by <tt>key(e)</tt> using a counting
+/// sort, so edges inside each bucket keep their relative order.
+///
+template <typename Index, typename KeyFunction>
+void build_csr(const size_t num_vertices, const size_t num_edges,
+               KeyFunction key, std::vector<size_t>& offset,
+               std::vector<Index>& adj) {
+  offset.assign(num_vertices + 1, 0);
+  for (size_t e = 0; e != num_edges; ++e)
+    ++offset[key(e) + 1];
+  for (size_t v = 0; v != num_vertices; ++v)
+    offset[v + 1] += offset[v];
+
+  std::vector<size_t> pos(offset.begin(), offset.end() - 1);
+  adj.resize(num_edges);
+  for (size_t e = 0; e != num_edges; ++e)
+    adj[pos[key(e)]++] = static_cast<Index>(e);
+}
+
+} // end namespace detail
+
+/// \brief Immutable directed graph stored in compressed sparse row format.
+///
+/// Out-edges and in-edges of every vertex are stored in two contiguous arrays
+/// so traversals touch a constant number of memory blocks regardless of the
+/// number of vertices. Edge descriptors are the positions of the edges in the
+/// edge list used to build the graph, so edge maps (e.g. weights) built for
+/// that list remain valid.
+///
+/// \tparam Index Unsigned integer type used to store vertex and edge
+/// descriptors.
+///
+template <typename Index = size_t>
+class basic_csr_directed_graph {
+  static_assert(std::is_integral<Index>::value &&
+                    std::is_unsigned<Index>::value,
+                "'Index' must be an unsigned integer type.");
+
+public:
+  using index_type = Index;
+
+private:
+  std::vector<std::pair<index_type, index_type>> edge_list;
+  std::vector<size_t> out_offset, in_offset;
+  std::vector<index_type> out_adj, in_adj;
+
+public:
+  /// \brief Builds the graph from an edge list.
+  ///
+  /// \param n_verts The number of vertices.
+  /// \param edges The list of edges. The edge <tt>edges[e]</tt> is given the
+  /// descriptor \c e.
+  ///
+  /// \par Complexity
+  /// <tt>O(V + E)</tt>.
+  ///
+  basic_csr_directed_graph(
+      const size_t n_verts,
+      std::vector<std::pair<index_type, index_type>> edges)
+      : edge_list(std::move(edges)) {
+    const size_t n_edges = edge_list.size();
+    detail::build_csr(n_verts, n_edges,
+                      [&](size_t e) { return edge_list[e].first; }, out_offset,
+                      out_adj);
+    detail::build_csr(n_verts, n_edges,
+                      [&](size_t e) { return edge_list[e].second; }, in_offset,
+                      in_adj);
+  }
+
+  /// \brief Builds a frozen copy of the given directed graph.
+  ///
+  /// Edge descriptors of \p g are preserved.
+  ///
+  /// \par Complexity
+  /// <tt>O(V + E)</tt>.
+  ///
+  template <typename Graph>
+  static basic_csr_directed_graph from_graph(const Graph& g) {
+    const size_t n_edges = g.num_edges();
+    std::vector<std::pair<index_type, index_type>> edges(n_edges);
+    for (size_t e = 0; e != n_edges; ++e)
+      edges[e] = {static_cast<index_type>(g.source(e)),
+                  static_cast<index_type>(g.target(e))};
+    return basic_csr_directed_graph(g.num_vertices(), std::move(edges));
+  }
+
+  size_t num_vertices() const {
+    return out_offset.size() - 1;
+  }
+  size_t num_edges() const {
+    return edge_list.size();
+  }
+
+  index_type source(size_t e) const {
+    return edge_list[e].first;
+  }
+  index_type target(size_t e) const {
+    return edge_list[e].second;
+  }
+
+  csr_edge_range<index_type> out_edges(size_t v) const {
+    return {out_adj.data() + out_offset[v], out_adj.data() + out_offset[v + 1]};
+  }
+  csr_edge_range<index_type> in_edges(size_t v) const {
+    return {in_adj.data() + in_offset[v], in_adj.data() + in_offset[v + 1]};
+  }
+
+  size_t out_degree(size_t v) const {
+    return out_offset[v + 1] - out_offset[v];
+  }
+  size_t in_degree(size_t v) const {
+    return in_offset[v + 1] - in_offset[v];
+  }
+};
+
+/// \brief Immutable undirected graph stored in compressed sparse row format.
+///
+/// Each edge appears in the incidence array of both of its endpoints (loops
+/// appear twice, as in \c undirected_graph). Edge descriptors are the
+/// positions of the edges in the edge list used to build the graph.
+///
+/// \tparam Index Unsigned integer type used to store vertex and edge
+/// descriptors.
+///
+template <typename Index = size_t>
+class basic_csr_undirected_graph {
+  static_assert(std::is_integral<Index>::value &&
+                    std::is_unsigned<Index>::value,
+                "'Index' must be an unsigned integer type.");
+
+public:
+  using index_type = Index;
+
+private:
+  std::vector<std::pair<index_type, index_type>> edge_list;
+  std::vector<size_t> offset;
+  std::vector<index_type> adj;
+
+public:
+  /// \brief Builds the graph from an edge list.
+  ///
+  /// \param n_verts The number of vertices.
+  /// \param edges The list of edges. The edge <tt>edges[e]</tt> is given the
+  /// descriptor \c e.
+  ///
+  /// \par Complexity
+  /// <tt>O(V + E)</tt>.
+  ///
+  basic_csr_undirected_graph(
+      const size_t n_verts,
+      std::vector<std::pair<index_type, index_type>> edges)
+      : edge_list(std::move(edges)), offset(n_verts + 1, 0) {
+    const size_t n_edges = edge_list.size();
+    for (const auto& edge : edge_list) {
+      ++offset[edge.first + 1];
+      ++offset[edge.second + 1];
+    }
+    for (size_t v = 0; v != n_verts; ++v)
+      offset[v + 1] += offset[v];
+
+    std::vector<size_t> pos(offset.begin(), offset.end() - 1);
+    adj.resize(offset.back());
+    for (size_t e = 0; e != n_edges; ++e) {
+      adj[pos[edge_list[e].first]++] = static_cast<index_type>(e);
+      adj[pos[edge_list[e].second]++] = static_cast<index_type>(e);
+    }
+  }
+
+  /// \brief Builds a frozen copy of the given undirected graph.
+  ///
+  /// Edge descriptors of \p g are preserved.
+  ///
+  /// \par Complexity
+  /// <tt>O(V + E)</tt>.
+  ///
+  template <typename Graph>
+  static basic_csr_undirected_graph from_graph(const Graph& g) {
+    const size_t n_edges = g.num_edges();
+    std::vector<std::pair<index_type, index_type>> edges(n_edges);
+    for (size_t e = 0; e != n_edges; ++e)
+      edges[e] = {static_cast<index_type>(g.source(e)),
+                  static_cast<index_type>(g.target(e))};
+    return basic_csr_undirected_graph(g.num_vertices(), std::move(edges));
+  }
+
+  size_t num_vertices() const {
+    return offset.size() - 1;
+  }
+  size_t num_edges() const {
+    return edge_list.size();
+  }
+
+  index_type source(size_t e) const {
+    return edge_list[e].first;
+  }
+  index_type target(size_t e) const {
+    return edge_list[e].second;
+  }
+
+  csr_edge_range<index_type> out_edges(size_t v) const {
+    return {adj.data() + offset[v], adj.data() + offset[v + 1]};
+  }
+  csr_edge_range<index_type> in_edges(size_t v) const {
+    return out_edges(v);
+  }
+
+  size_t degree(size_t v) const {
+    return offset[v + 1] - offset[v];
+  }
+  size_t out_degree(size_t v) const {
+    return degree(v);
+  }
+  size_t in_degree(size_t v) const {
+    return degree(v);
+  }
+};
+
+/// \brief CSR directed graph using \c size_t descriptors.
+///
+using csr_directed_graph = basic_csr_directed_graph<>;
+
+/// \brief CSR undirected graph using \c size_t descriptors.
+///
+using csr_undirected_graph = basic_csr_undirected_graph<>;
+
+} // end namespace cpl
+
+#endif // Header guard
@@ -6,14 +6,34 @@
 #ifndef CPL_GRAPH_DAG_SHORTEST_PATHS_HPP
 #define CPL_GRAPH_DAG_SHORTEST_PATHS_HPP
 
-#include <algorithm>  // for_each, min
-#include <cstddef>    // size_t
-#include <functional> // function
-#include <limits>     // numeric_limits
-#include <vector>     // vector
+#include <cpl/graph/depth_first_search.hpp> // depth_first_visit
+#include <algorithm>                         // for_each, min
+#include <cstddef>                           // size_t
+#include <limits>                            // numeric_limits
+#include <vector>                            // vector
 
 namespace cpl {
 
+namespace detail {
+
+template <typename Graph>
+class reverse_topological_visitor : public dfs_visitor {
+  using index_type = typename Graph::index_type;
+
+public:
+  explicit reverse_topological_visitor(std::vector<index_type>& rev_topo_)
+      : rev_topo(rev_topo_) {}
+
+  void finish_vertex(const index_type v) {
+    rev_topo.push_back(v);
+  }
+
+private:
+  std::vector<index_type>& rev_topo;
+};
+
+} // end namespace detail
+
 /// \brief Solves the single-source shortest-paths problem on a weighted,
 /// directed acyclic graph.
 ///
@@ -35,29 +55,22 @@ template <typename Graph, typename Distance>
 void dag_shortest_paths(const Graph& g, const size_t source,
                         const std::vector<Distance>& weight,
                         std::vector<Distance>& dist) {
+  using index_type = typename Graph::index_type;
   const size_t num_v = g.num_vertices();
-  std::vector<bool> visited(num_v);
-  std::vector<size_t> rev_topo;
+  std::vector<dfs_color> color(num_v, dfs_color::white);
+  std::vector<index_type> rev_topo;
   rev_topo.reserve(num_v);
 
-  std::function<void(size_t)> dfs = [&](const size_t src) {
-    visited[src] = true;
-    for (const auto e : g.out_edges(src)) {
-      const size_t tgt = g.target(e);
-      if (!visited[tgt])
-        dfs(tgt);
-    }
-    rev_topo.push_back(src);
-  };
-  dfs(source);
+  detail::reverse_topological_visitor<Graph> vis(rev_topo);
+  depth_first_visit(g, source, vis, color);
 
   // Note: If 'limits::max()' is changed by 'limits::min()' and 'std::min' is
   // changed by 'std::max' it gives as a result the longest paths.
   dist.assign(num_v, std::numeric_limits<Distance>::max());
   dist[source] = 0;
-  std::for_each(rev_topo.rbegin(), rev_topo.rend(), [&](const size_t src) {
+  std::for_each(rev_topo.rbegin(), rev_topo.rend(), [&](const index_type src) {
     for (const auto e : g.out_edges(src)) {
-      const size_t tgt = g.target(e);
+      const index_type tgt = g.target(e);
       dist[tgt] = std::min(dist[tgt], dist[src] + weight[e]);
     }
   });
@@ -0,0 +1,243 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the delta-stepping algorithm.
+
+#ifndef CPL_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
+#define CPL_GRAPH_DELTA_STEPPING_SHORTEST_PATHS_HPP
+
+#include <cpl/utility/parallel.hpp> // parallel_for
+#include <algorithm>                // max, max_element
+#include <cassert>                  // assert
+#include <cstddef>                  // size_t
+#include <limits>                   // numeric_limits
+#include <utility>                  // pair
+#include <vector>                   // vector
+
+namespace cpl {
+
+/// \brief Solves the single-source shortest paths problem by relaxing
+/// vertices in buckets of width \p delta.
+///
+/// Vertices with tentative distance in <tt>[i * delta, (i + 1) * delta)</tt>
+/// are kept in the bucket \c i. Buckets are processed in increasing order,
+/// but the vertices inside a bucket are processed in any order: light edges
+/// (weight at most \p delta) are relaxed until the bucket becomes empty, and
+/// then the heavy edges of all the vertices removed from the bucket are
+/// relaxed once. Every vertex of a bucket can be processed independently,
+/// which the overload taking a number of threads exploits.
+///
+/// A \p delta close to the maximum weight makes the algorithm behave like
+/// Bellman-Ford inside each bucket, while a tiny one makes it behave like
+/// Dijkstra's algorithm with a bucket queue.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param weight Weight map of edges.
+/// \param delta Width of the buckets.
+///
+/// \returns A vector \c dist such that <tt>dist[v]</tt> contains the shortest
+/// distance from the vertex \p source to the vertex \c v. Distances to
+/// unreachable vertices are set to
+/// <tt>std::numeric_limits<Distance>::max()</tt>. The result is the same as
+/// the one of \c dijkstra_shortest_paths.
+///
+/// \pre All weights must be non-negative and \p delta must be positive.
+///
+/// \par Complexity
+/// <tt>O(V + E + D / delta)</tt> for random weights and a suitable \p delta,
+/// where \c D is the largest finite distance from \p source.
+/// <tt>O(V * E)</tt> in the worst case.
+///
+/// \sa dijkstra_shortest_paths
+///
+template <class Graph, class Distance>
+std::vector<Distance>
+delta_stepping_shortest_paths(const Graph& g, const size_t source,
+                              const std::vector<Distance>& weight,
+                              const Distance delta) {
+  assert(delta > 0);
+  using index_type = typename Graph::index_type;
+  using bucket_type = std::vector<std::pair<Distance, index_type>>;
+
+  // Relaxations from the bucket i land at most max_weight / delta + 1 buckets
+  // ahead, so that many buckets (plus one for rounding) can be reused
+  // cyclically.
+  const Distance max_weight =
+      weight.empty() ? 0 : *std::max_element(weight.begin(), weight.end());
+  const size_t num_buckets = static_cast<size_t>(max_weight / delta) + 3;
+  auto bucket_of = [&](const Distance d) {
+    return static_cast<size_t>(d / delta) % num_buckets;
+  };
+
+  std::vector<bucket_type> buckets(num_buckets);
+  std::vector<Distance> dist(g.num_vertices(),
+                             std::numeric_limits<Distance>::max());
+  std::vector<bool> removed(g.num_vertices(), false);
+  std::vector<index_type> settled; // Vertices removed from the bucket.
+  size_t num_queued = 0;
+
+  auto relax = [&](const index_type v, const Distance alt) {
+    if (alt < dist[v]) {
+      dist[v] = alt;
+      buckets[bucket_of(alt)].emplace_back(alt, v);
+      ++num_queued;
+    }
+  };
+
+  relax(static_cast<index_type>(source), 0);
+  for (size_t curr = 0; num_queued != 0; curr = (curr + 1) % num_buckets) {
+    auto& bucket = buckets[curr];
+    if (bucket.empty())
+      continue;
+
+    // Light edges may insert vertices back in the current bucket.
+    while (!bucket.empty()) {
+      const auto entry = bucket.back();
+      bucket.pop_back();
+      --num_queued;
+      const index_type u = entry.second;
+      if (entry.first != dist[u])
+        continue; // Stale entry.
+
+      if (!removed[u]) {
+        removed[u] = true;
+        settled.push_back(u);
+      }
+      for (const auto edge : g.out_edges(u))
+        if (weight[edge] <= delta)
+          relax(g.target(edge), dist[u] + weight[edge]);
+    }
+
+    // Distances of the settled vertices are final now.
+    for (const index_type u : settled) {
+      removed[u] = false;
+      for (const auto edge : g.out_edges(u))
+        if (weight[edge] > delta)
+          relax(g.target(edge), dist[u] + weight[edge]);
+    }
+    settled.clear();
+  }
+  return dist;
+}
+
+/// \brief Solves the single-source shortest paths problem by relaxing
+/// buckets of width \p delta on several threads.
+///
+/// Works like the sequential overload, but in phases: each phase takes all
+/// the vertices of the current bucket at once, and the threads scan the
+/// light edges of disjoint chunks of them, only reading the distances and
+/// writing the improving relaxation requests to their own lists. The lists
+/// are then merged by the calling thread, which updates the distances and
+/// the buckets. Phases repeat until the bucket stays empty, and the heavy
+/// edges of the removed vertices are handled in the same way once.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param weight Weight map of edges.
+/// \param delta Width of the buckets.
+/// \param num_threads The number of threads to use.
+///
+/// \returns The same vector as the sequential overload, which is also the
+/// one returned by \c dijkstra_shortest_paths.
+///
+/// \pre All weights must be non-negative and \p delta must be positive.
+///
+/// \par Complexity
+/// The same work as the sequential overload. The edge scans are divided
+/// among the threads, but merging the requests is sequential.
+///
+template <class Graph, class Distance>
+std::vector<Distance>
+delta_stepping_shortest_paths(const Graph& g, const size_t source,
+                              const std::vector<Distance>& weight,
+                              const Distance delta, const size_t num_threads) {
+  assert(delta > 0);
+  using index_type = typename Graph::index_type;
+  using request_type = std::pair<Distance, index_type>;
+
+  const Distance max_weight =
+      weight.empty() ? 0 : *std::max_element(weight.begin(), weight.end());
+  const size_t num_buckets = static_cast<size_t>(max_weight / delta) + 3;
+  auto bucket_of = [&](const Distance d) {
+    return static_cast<size_t>(d / delta) % num_buckets;
+  };
+
+  std::vector<std::vector<request_type>> buckets(num_buckets);
+  std::vector<Distance> dist(g.num_vertices(),
+                             std::numeric_limits<Distance>::max());
+  std::vector<bool> removed(g.num_vertices(), false);
+  std::vector<index_type> frontier, settled;
+  std::vector<std::vector<request_type>> requests(
+      std::max(num_threads, size_t{1})); // One list per chunk.
+  size_t num_queued = 0;
+
+  auto relax = [&](const index_type v, const Distance alt) {
+    if (alt < dist[v]) {
+      dist[v] = alt;
+      buckets[bucket_of(alt)].emplace_back(alt, v);
+      ++num_queued;
+    }
+  };
+
+  // Relaxes the light or the heavy edges leaving the given vertices.
+  auto relax_all = [&](const std::vector<index_type>& vertices,
+                       const bool light) {
+    auto scan = [&](const size_t chunk, const size_t first, const size_t last) {
+      auto& out = requests[chunk];
+      for (size_t i = first; i != last; ++i) {
+        const index_type u = vertices[i];
+        for (const auto edge : g.out_edges(u)) {
+          if ((weight[edge] <= delta) != light)
+            continue;
+          const index_type v = g.target(edge);
+          const Distance alt = dist[u] + weight[edge];
+          if (alt < dist[v])
+            out.emplace_back(alt, v);
+        }
+      }
+    };
+    parallel_for(vertices.size(), num_threads, scan);
+    for (auto& out : requests) {
+      for (const auto& request : out)
+        relax(request.second, request.first);
+      out.clear();
+    }
+  };
+
+  relax(static_cast<index_type>(source), 0);
+  for (size_t curr = 0; num_queued != 0; curr = (curr + 1) % num_buckets) {
+    auto& bucket = buckets[curr];
+    if (bucket.empty())
+      continue;
+
+    while (!bucket.empty()) {
+      for (const auto& entry : bucket) {
+        const index_type u = entry.second;
+        if (entry.first != dist[u])
+          continue; // Stale entry.
+        frontier.push_back(u);
+        if (!removed[u]) {
+          removed[u] = true;
+          settled.push_back(u);
+        }
+      }
+      num_queued -= bucket.size();
+      bucket.clear();
+      relax_all(frontier, true);
+      frontier.clear();
+    }
+
+    relax_all(settled, false);
+    for (const index_type u : settled)
+      removed[u] = false;
+    settled.clear();
+  }
+  return dist;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
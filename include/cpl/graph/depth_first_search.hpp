@@ -0,0 +1,192 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Defines a non-recursive depth-first search engine.
+
+#ifndef CPL_GRAPH_DEPTH_FIRST_SEARCH_HPP
+#define CPL_GRAPH_DEPTH_FIRST_SEARCH_HPP
+
+#include <cstddef>  // size_t
+#include <iterator> // begin, end
+#include <limits>   // numeric_limits
+#include <utility>  // declval
+#include <vector>   // vector
+
+namespace cpl {
+
+/// \brief Color of a vertex during a depth-first search.
+///
+/// White vertices have not been discovered yet, gray vertices are in the
+/// current DFS path and black vertices have been finished.
+///
+enum class dfs_color : unsigned char { white, gray, black };
+
+/// \brief Visitor with no-op event points, intended to be used as base class.
+///
+/// Derived visitors hide the event points they are interested in. Since the
+/// engine is a template, calls are resolved (and usually inlined) at compile
+/// time.
+///
+/// For undirected graphs, each edge is examined from both endpoints, so the
+/// edge leading to the parent of a vertex is reported as a back edge.
+///
+struct dfs_visitor {
+  /// \brief Invoked on each root before it is discovered.
+  void start_vertex(size_t) {}
+
+  /// \brief Invoked when a vertex is reached for the first time.
+  void discover_vertex(size_t) {}
+
+  /// \brief Invoked on each edge <tt>(u, v)</tt> such that \c v is white.
+  void tree_edge(size_t /*e*/, size_t /*u*/, size_t /*v*/) {}
+
+  /// \brief Invoked on each edge <tt>(u, v)</tt> such that \c v is gray.
+  void back_edge(size_t /*e*/, size_t /*u*/, size_t /*v*/) {}
+
+  /// \brief Invoked on each edge <tt>(u, v)</tt> such that \c v is black.
+  void forward_or_cross_edge(size_t /*e*/, size_t /*u*/, size_t /*v*/) {}
+
+  /// \brief Invoked on each tree edge <tt>(u, v)</tt> once \c v is finished.
+  void finish_edge(size_t /*e*/, size_t /*u*/, size_t /*v*/) {}
+
+  /// \brief Invoked when all the out-edges of a vertex have been examined.
+  void finish_vertex(size_t) {}
+
+  /// \brief Checked after each event point. Returning \c true aborts the
+  /// search.
+  bool done() const {
+    return false;
+  }
+};
+
+namespace detail {
+
+template <typename Graph>
+struct dfs_stack_frame {
+  using index_type = typename Graph::index_type;
+  using edge_iterator =
+      decltype(std::begin(std::declval<const Graph&>().out_edges(0)));
+
+  index_type vertex;
+  index_type pred_edge;
+  edge_iterator next_edge;
+  edge_iterator last_edge;
+};
+
+template <typename Graph, typename Visitor>
+bool depth_first_visit(const Graph& g, const size_t root, Visitor& vis,
+                       std::vector<dfs_color>& color,
+                       std::vector<dfs_stack_frame<Graph>>& stack) {
+  using index_type = typename Graph::index_type;
+  const auto nil = std::numeric_limits<index_type>::max();
+  stack.clear();
+
+  auto discover = [&](const index_type v, const index_type pred_edge) {
+    color[v] = dfs_color::gray;
+    vis.discover_vertex(v);
+    const auto& edges = g.out_edges(v);
+    stack.push_back({v, pred_edge, std::begin(edges), std::end(edges)});
+  };
+
+  discover(static_cast<index_type>(root), nil);
+  if (vis.done())
+    return false;
+
+  while (!stack.empty()) {
+    auto& top = stack.back();
+    if (top.next_edge != top.last_edge) {
+      const index_type e = *top.next_edge++;
+      const index_type u = top.vertex;
+      const index_type v = (u == g.source(e)) ? g.target(e) : g.source(e);
+      switch (color[v]) {
+      case dfs_color::white:
+        vis.tree_edge(e, u, v);
+        if (vis.done())
+          return false;
+        discover(v, e);
+        break;
+      case dfs_color::gray:
+        vis.back_edge(e, u, v);
+        break;
+      case dfs_color::black:
+        vis.forward_or_cross_edge(e, u, v);
+        break;
+      }
+    } else {
+      const index_type u = top.vertex;
+      const index_type pred_edge = top.pred_edge;
+      stack.pop_back();
+      color[u] = dfs_color::black;
+      vis.finish_vertex(u);
+      if (!stack.empty())
+        vis.finish_edge(pred_edge, stack.back().vertex, u);
+    }
+    if (vis.done())
+      return false;
+  }
+  return true;
+}
+
+} // end namespace detail
+
+/// \brief Performs a depth-first search from the given root.
+///
+/// Only vertices reachable from \p root through white vertices are visited.
+/// The search uses an explicit stack, so its depth is not limited by the size
+/// of the call stack.
+///
+/// \param g The target graph. If it is undirected, the neighbor of \c u through
+/// the edge \c e is taken as the endpoint of \c e distinct to \c u.
+/// \param root The vertex to start from.
+/// \param vis The visitor. See \c dfs_visitor for the event points.
+/// \param[in,out] color The color map. It must have one entry per vertex and
+/// \p root must be white. Visited vertices are left black.
+///
+/// \returns \c false if the search was aborted by the visitor, \c true
+/// otherwise.
+///
+/// \par Complexity
+/// <tt>O(V + E)</tt>.
+///
+template <typename Graph, typename Visitor>
+bool depth_first_visit(const Graph& g, const size_t root, Visitor& vis,
+                       std::vector<dfs_color>& color) {
+  std::vector<detail::dfs_stack_frame<Graph>> stack;
+  return detail::depth_first_visit(g, root, vis, color, stack);
+}
+
+/// \brief Performs a depth-first search over the whole graph.
+///
+/// Vertices are tried as roots in increasing order. Each time a white vertex
+/// \c v is found, <tt>vis.start_vertex(v)</tt> is invoked and a new search
+/// tree is grown from \c v.
+///
+/// \param g The target graph.
+/// \param vis The visitor. See \c dfs_visitor for the event points.
+///
+/// \returns \c false if the search was aborted by the visitor, \c true
+/// otherwise.
+///
+/// \par Complexity
+/// <tt>O(V + E)</tt>.
+///
+template <typename Graph, typename Visitor>
+bool depth_first_search(const Graph& g, Visitor& vis) {
+  const size_t num_v = g.num_vertices();
+  std::vector<dfs_color> color(num_v, dfs_color::white);
+  std::vector<detail::dfs_stack_frame<Graph>> stack;
+  for (size_t v = 0; v != num_v; ++v) {
+    if (color[v] != dfs_color::white)
+      continue;
+    vis.start_vertex(v);
+    if (!detail::depth_first_visit(g, v, vis, color, stack))
+      return false;
+  }
+  return true;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
@@ -0,0 +1,88 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements Dial's algorithm.
+
+#ifndef CPL_GRAPH_DIAL_SHORTEST_PATHS_HPP
+#define CPL_GRAPH_DIAL_SHORTEST_PATHS_HPP
+
+#include <algorithm>   // max_element
+#include <cstddef>     // size_t
+#include <limits>      // numeric_limits
+#include <type_traits> // is_integral
+#include <vector>      // vector
+
+namespace cpl {
+
+/// \brief Solves the single-source shortest paths problem for small integer
+/// weights.
+///
+/// This is a variant of the Dijkstra's algorithm which uses a circular array
+/// of <tt>C + 1</tt> buckets as priority queue, where \c C is the maximum edge
+/// weight. It outperforms heap-based implementations when \c C is small.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param weight Weight map of edges.
+///
+/// \returns A vector \c dist such that <tt>dist[v]</tt> contains the shortest
+/// distance from the vertex \p source to the vertex \c v. Distances to
+/// unreachable vertices are set to
+/// <tt>std::numeric_limits<Distance>::max()</tt>.
+///
+/// \pre All weights must be non-negative.
+///
+/// \par Complexity
+/// <tt>O(V + E + D)</tt> time and <tt>O(V + C)</tt> additional space, where
+/// \c D is the largest finite distance from \p source.
+///
+/// \sa dijkstra_shortest_paths
+///
+template <class Graph, class Distance>
+std::vector<Distance> dial_shortest_paths(const Graph& g, const size_t source,
+                                          const std::vector<Distance>& weight) {
+  static_assert(std::is_integral<Distance>::value,
+                "'Distance' must be an integral type.");
+  using index_type = typename Graph::index_type;
+
+  const size_t num_buckets =
+      weight.empty()
+          ? 1
+          : static_cast<size_t>(*std::max_element(weight.begin(),
+                                                  weight.end())) + 1;
+  std::vector<std::vector<index_type>> buckets(num_buckets);
+  std::vector<Distance> dist(g.num_vertices(),
+                             std::numeric_limits<Distance>::max());
+
+  dist[source] = 0;
+  buckets[0].push_back(static_cast<index_type>(source));
+  size_t num_queued = 1;
+
+  for (Distance curr = 0; num_queued != 0; ++curr) {
+    auto& bucket = buckets[static_cast<size_t>(curr) % num_buckets];
+    while (!bucket.empty()) {
+      const index_type u = bucket.back();
+      bucket.pop_back();
+      --num_queued;
+      if (dist[u] != curr)
+        continue; // Stale entry.
+
+      for (const auto edge : g.out_edges(u)) {
+        const index_type v = g.target(edge);
+        const Distance alt = curr + weight[edge];
+        if (alt >= dist[v])
+          continue;
+        dist[v] = alt;
+        buckets[static_cast<size_t>(alt) % num_buckets].push_back(v);
+        ++num_queued;
+      }
+    }
+  }
+  return dist;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
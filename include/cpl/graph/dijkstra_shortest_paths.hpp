@@ -8,37 +8,28 @@
 #ifndef CPL_GRAPH_DIJKSTRA_SHORTEST_PATHS_HPP
 #define CPL_GRAPH_DIJKSTRA_SHORTEST_PATHS_HPP
 
-#include <cstddef> // size_t
-#include <limits>  // numeric_limits
-#include <queue>   // priority_queue
-#include <vector>  // vector
+#include <cpl/data_structure/indexed_dary_heap.hpp> // indexed_dary_heap
+#include <cpl/data_structure/radix_heap.hpp>        // radix_heap
+#include <cstddef>                                  // size_t
+#include <limits>                                   // numeric_limits
+#include <queue>                                    // priority_queue
+#include <type_traits>                              // integral_constant, is_same, make_unsigned
+#include <vector>                                   // vector
 
 namespace cpl {
 
-/// \brief Solves the single-source shortest paths problem.
-///
-/// \tparam Graph Directed graph type.
-/// \tparam Distance Distance type.
-///
-/// \param g The target graph.
-/// \param source The source vertex.
-/// \param weight Weight map of edges.
-///
-/// \returns A vector \c dist such that  <tt>dist[v]</tt> contains the shortest
-/// distance from the vertex \p source to the vertex \c v. Note that
-/// <tt>dist[source] == 0</tt>.
-///
-/// \par Complexity
-/// <tt>O(E * log(V))</tt> (uses a binary heap).
-///
+namespace detail {
+
 template <class Graph, class Distance>
 std::vector<Distance>
 dijkstra_shortest_paths(const Graph& g, size_t source,
-                        const std::vector<Distance>& weight) {
+                        const std::vector<Distance>& weight,
+                        std::false_type /*use_radix_heap*/) {
 
+  using index_type = typename Graph::index_type;
   struct pq_elem {
     Distance dist;
-    size_t vertex;
+    index_type vertex;
     bool operator<(const pq_elem& that) const {
       return dist > that.dist;
     }
@@ -49,17 +40,17 @@ dijkstra_shortest_paths(const Graph& g, size_t source,
                              std::numeric_limits<Distance>::max());
 
   std::priority_queue<pq_elem> pq;
-  pq.push({dist[source] = 0, source});
+  pq.push({dist[source] = 0, static_cast<index_type>(source)});
 
   while (!pq.empty()) {
-    const size_t u = pq.top().vertex;
+    const index_type u = pq.top().vertex;
     pq.pop();
     if (visited[u])
       continue;
 
     visited[u] = true;
     for (const auto edge : g.out_edges(u)) {
-      const size_t v = g.target(edge);
+      const index_type v = g.target(edge);
       const Distance alt = dist[u] + weight[edge]; // alternative
       if (alt < dist[v])
         pq.push({dist[v] = alt, v});
@@ -68,6 +59,123 @@ dijkstra_shortest_paths(const Graph& g, size_t source,
   return dist;
 }
 
+// Distances are non-negative and extracted in increasing order, so integral
+// distances can be kept in a radix heap instead of a binary heap.
+template <class Graph, class Distance>
+std::vector<Distance>
+dijkstra_shortest_paths(const Graph& g, size_t source,
+                        const std::vector<Distance>& weight,
+                        std::true_type /*use_radix_heap*/) {
+
+  using index_type = typename Graph::index_type;
+  using key_type = typename std::make_unsigned<Distance>::type;
+
+  std::vector<Distance> dist(g.num_vertices(),
+                             std::numeric_limits<Distance>::max());
+
+  radix_heap<key_type, index_type> pq;
+  dist[source] = 0;
+  pq.push(0, static_cast<index_type>(source));
+
+  while (!pq.empty()) {
+    const auto top = pq.top();
+    pq.pop();
+    const index_type u = top.second;
+    if (top.first != static_cast<key_type>(dist[u]))
+      continue; // Stale entry.
+
+    for (const auto edge : g.out_edges(u)) {
+      const index_type v = g.target(edge);
+      const Distance alt = dist[u] + weight[edge]; // alternative
+      if (alt < dist[v])
+        pq.push(static_cast<key_type>(dist[v] = alt), v);
+    }
+  }
+  return dist;
+}
+
+} // end namespace detail
+
+/// \brief Solves the single-source shortest paths problem.
+///
+/// \tparam Graph Directed graph type.
+/// \tparam Distance Distance type.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param weight Weight map of edges.
+///
+/// \returns A vector \c dist such that  <tt>dist[v]</tt> contains the shortest
+/// distance from the vertex \p source to the vertex \c v. Note that
+/// <tt>dist[source] == 0</tt>.
+///
+/// \pre All weights must be non-negative.
+///
+/// \par Complexity
+/// <tt>O(E * log(V))</tt> (uses a binary heap). If \c Distance is an integral
+/// type other than \c bool, a radix heap is used instead, giving
+/// <tt>O(E * log(C))</tt> where \c C is the largest distance: every successful
+/// relaxation pushes an entry, and each entry is moved between buckets at
+/// most <tt>O(log(C))</tt> times.
+///
+/// \sa dial_shortest_paths
+///
+template <class Graph, class Distance>
+std::vector<Distance>
+dijkstra_shortest_paths(const Graph& g, size_t source,
+                        const std::vector<Distance>& weight) {
+  using use_radix_heap =
+      std::integral_constant<bool, std::is_integral<Distance>::value &&
+                                       !std::is_same<Distance, bool>::value>;
+  return detail::dijkstra_shortest_paths(g, source, weight, use_radix_heap{});
+}
+
+/// \brief Solves the single-source shortest paths problem using an indexed
+/// heap with decrease-key.
+///
+/// Unlike the lazy-deletion variants, each vertex is queued at most once, so
+/// the heap never holds more than \c V entries.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param weight Weight map of edges.
+/// \param heap The heap used as priority queue. It must be empty, and it is
+/// resized to the number of vertices. Its storage can be reused by successive
+/// calls.
+///
+/// \returns A vector \c dist such that <tt>dist[v]</tt> contains the shortest
+/// distance from the vertex \p source to the vertex \c v.
+///
+/// \pre All weights must be non-negative.
+///
+/// \par Complexity
+/// <tt>O((V * Arity + E) * log(V) / log(Arity))</tt>.
+///
+template <class Graph, class Distance, size_t Arity>
+std::vector<Distance>
+dijkstra_shortest_paths(const Graph& g, const size_t source,
+                        const std::vector<Distance>& weight,
+                        indexed_dary_heap<Distance, Arity>& heap) {
+  using index_type = typename Graph::index_type;
+  std::vector<Distance> dist(g.num_vertices(),
+                             std::numeric_limits<Distance>::max());
+
+  heap.resize(g.num_vertices());
+  heap.push(source, dist[source] = 0);
+
+  while (!heap.empty()) {
+    const auto u = static_cast<index_type>(heap.top());
+    heap.pop();
+    for (const auto edge : g.out_edges(u)) {
+      const index_type v = g.target(edge);
+      const Distance alt = dist[u] + weight[edge]; // alternative
+      if (alt < dist[v])
+        heap.push_or_decrease(v, dist[v] = alt);
+    }
+  }
+  return dist;
+}
+
 } // namespace cpl
 
 #endif // Header guard
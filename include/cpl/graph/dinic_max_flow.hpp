@@ -0,0 +1,204 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the Dinic's algorithm.
+
+#ifndef CPL_GRAPH_DINIC_MAX_FLOW_HPP
+#define CPL_GRAPH_DINIC_MAX_FLOW_HPP
+
+#include <cpl/graph/flow_network.hpp> // flow_network
+#include <algorithm>                  // min
+#include <cstddef>                    // size_t
+#include <iterator>                   // begin
+#include <limits>                     // numeric_limits
+#include <type_traits>                // is_arithmetic
+#include <vector>                     // vector
+
+namespace cpl {
+
+namespace detail {
+
+// Scratch buffers of dinic_run, which can be kept between calls.
+template <typename Index>
+struct dinic_workspace {
+  std::vector<Index> level;
+  std::vector<Index> bfs_queue;
+  std::vector<size_t> current; // Position of the current edge.
+  std::vector<Index> path;     // Edges from source to 'curr'.
+};
+
+// 'residual' must hold the initial capacities. See edmonds_karp_run.
+template <typename Flow, typename Graph, typename RevEdgeMap,
+          typename ResidualMap, typename Index>
+Flow dinic_run(const Graph& g, const size_t source, const size_t target,
+               const RevEdgeMap& rev_edge, ResidualMap& residual,
+               dinic_workspace<Index>& workspace) {
+
+  static_assert(std::is_arithmetic<Flow>::value, "'Flow' must be arithmetic.");
+  const auto nil = std::numeric_limits<Index>::max();
+  const size_t num_v = g.num_vertices();
+
+  auto& level = workspace.level;
+  auto& bfs_queue = workspace.bfs_queue;
+  auto& current = workspace.current;
+  auto& path = workspace.path;
+
+  auto build_levels = [&] {
+    level.assign(num_v, nil);
+    level[source] = 0;
+    bfs_queue.assign(1, static_cast<Index>(source));
+    for (size_t head = 0; head != bfs_queue.size(); ++head) {
+      const Index curr = bfs_queue[head];
+      for (const auto edge : g.out_edges(curr)) {
+        const Index child = g.target(edge);
+        if (level[child] != nil || !residual[edge])
+          continue;
+        level[child] = level[curr] + 1;
+        bfs_queue.push_back(child);
+      }
+    }
+    return level[target] != nil;
+  };
+
+  Flow total_flow = 0;
+  while (build_levels()) {
+    current.assign(num_v, 0);
+    path.clear();
+    auto curr = static_cast<typename Graph::index_type>(source);
+    while (true) {
+      if (curr == target) {
+        Flow path_flow = std::numeric_limits<Flow>::max();
+        for (const auto e : path)
+          path_flow = std::min(path_flow, residual[e]);
+        for (const auto e : path) {
+          residual[e] -= path_flow;
+          residual[rev_edge[e]] += path_flow;
+        }
+        total_flow += path_flow;
+
+        // Retreat to the tail of the first saturated edge.
+        size_t i = 0;
+        while (residual[path[i]])
+          ++i;
+        curr = g.source(path[i]);
+        path.resize(i);
+        continue;
+      }
+
+      const auto& edges = g.out_edges(curr);
+      const size_t degree = edges.size();
+      size_t& pos = current[curr];
+      for (; pos != degree; ++pos) {
+        const auto edge = std::begin(edges)[pos];
+        if (residual[edge] && level[g.target(edge)] == level[curr] + 1)
+          break;
+      }
+
+      if (pos != degree) { // Advance.
+        path.push_back(std::begin(edges)[pos]);
+        curr = g.target(path.back());
+      } else { // Dead end, retreat.
+        level[curr] = nil;
+        if (path.empty())
+          break;
+        curr = g.source(path.back());
+        path.pop_back();
+        ++current[curr];
+      }
+    }
+  }
+  return total_flow;
+}
+
+} // end namespace detail
+
+/// \brief Solves the maximum flow problem using the Dinic's algorithm.
+///
+/// Each phase computes the BFS level of every vertex in the residual graph
+/// and saturates all the shortest augmenting paths at once, following only
+/// edges from a level to the next one. Each vertex keeps a pointer to its
+/// current edge, so edges found useless are never examined again during the
+/// phase.
+///
+/// The requirements on \p g, \p rev_edge and \p capacity are the same as in
+/// \c edmonds_karp_max_flow.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param target The target vertex.
+/// \param rev_edge The reverse edge map.
+/// \param capacity The capacity map.
+/// \param[out] residual The residual capacity map. The final flow of each
+/// edge \c e can be obtained as <tt>capacity[e] - residual[e]</tt>.
+///
+/// \returns The maximum possible flow from \p source to \p target.
+///
+/// \pre <tt>source != target</tt>
+///
+/// \par Complexity
+/// <tt>O(V^2 * E)</tt> in general, and <tt>O(E * sqrt(V))</tt> on unit
+/// capacity bipartite networks.
+///
+/// \sa edmonds_karp_max_flow, push_relabel_max_flow
+///
+template <typename Graph, typename Flow>
+Flow dinic_max_flow(const Graph& g, const size_t source, const size_t target,
+                    const std::vector<typename Graph::index_type>& rev_edge,
+                    const std::vector<Flow>& capacity,
+                    std::vector<Flow>& residual) {
+  residual = capacity;
+  detail::dinic_workspace<typename Graph::index_type> workspace;
+  return detail::dinic_run<Flow>(g, source, target, rev_edge, residual,
+                                 workspace);
+}
+
+/// \brief Overload of \c dinic_max_flow which works directly on a
+/// \c flow_network. The residual capacities of \p net are reset before
+/// solving and hold the final residual capacities afterwards.
+///
+template <typename Flow, typename Index>
+Flow dinic_max_flow(flow_network<Flow, Index>& net, const size_t source,
+                    const size_t target) {
+  net.reset();
+  auto residual = net.residual_capacity_map();
+  detail::dinic_workspace<Index> workspace;
+  return detail::dinic_run<Flow>(net, source, target, net.rev_edge_map(),
+                                 residual, workspace);
+}
+
+/// \brief Function object which solves max-flow problems like
+/// \c dinic_max_flow. It can be used to select the max-flow algorithm of
+/// \c min_st_cut and \c gusfield_all_pairs_min_cut.
+///
+/// Like \c edmonds_karp_engine, it keeps its scratch buffers between calls
+/// and must not be shared by threads.
+///
+class dinic_engine {
+  detail::dinic_workspace<size_t> workspace;
+
+public:
+  template <typename Graph, typename Flow>
+  Flow operator()(const Graph& g, const size_t source, const size_t target,
+                  const std::vector<typename Graph::index_type>& rev_edge,
+                  const std::vector<Flow>& capacity,
+                  std::vector<Flow>& residual) {
+    residual = capacity;
+    return detail::dinic_run<Flow>(g, source, target, rev_edge, residual,
+                                   workspace);
+  }
+
+  template <typename Flow, typename Index>
+  Flow operator()(flow_network<Flow, Index>& net, const size_t source,
+                  const size_t target) {
+    net.reset();
+    auto residual = net.residual_capacity_map();
+    return detail::dinic_run<Flow>(net, source, target, net.rev_edge_map(),
+                                   residual, workspace);
+  }
+};
+
+} // end namespace cpl
+
+#endif // Header guard
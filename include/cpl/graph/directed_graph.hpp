@@ -6,25 +6,40 @@
 #ifndef CPL_GRAPH_DIRECTED_GRAPH_HPP
 #define CPL_GRAPH_DIRECTED_GRAPH_HPP
 
-#include <cstddef> // size_t
-#include <utility> // pair
-#include <vector>  // vector
+#include <cstddef>     // size_t
+#include <type_traits> // is_integral, is_unsigned
+#include <utility>     // pair
+#include <vector>      // vector
 
 namespace cpl {
 
 /// \brief Adjacency list which represents directed graphs.
 ///
-class directed_graph {
-  std::vector<std::vector<size_t>> outedges, inedges;
-  std::vector<std::pair<size_t, size_t>> edge_list;
+/// \tparam Index Unsigned integer type used to store vertex and edge
+/// descriptors. Using a narrower type than \c size_t (e.g. \c uint32_t) reduces
+/// the memory footprint of the graph and of the algorithms that run on it.
+///
+template <typename Index = size_t>
+class basic_directed_graph {
+  static_assert(std::is_integral<Index>::value &&
+                    std::is_unsigned<Index>::value,
+                "'Index' must be an unsigned integer type.");
+
+public:
+  using index_type = Index;
+
+private:
+  std::vector<std::vector<index_type>> outedges, inedges;
+  std::vector<std::pair<index_type, index_type>> edge_list;
 
 public:
-  explicit directed_graph(size_t n_verts)
+  explicit basic_directed_graph(size_t n_verts)
       : outedges(n_verts), inedges(n_verts) {}
 
-  size_t add_edge(size_t src, size_t tgt) {
-    edge_list.emplace_back(src, tgt);
-    const size_t edge_id = edge_list.size() - 1;
+  index_type add_edge(size_t src, size_t tgt) {
+    edge_list.emplace_back(static_cast<index_type>(src),
+                           static_cast<index_type>(tgt));
+    const auto edge_id = static_cast<index_type>(edge_list.size() - 1);
     outedges[src].push_back(edge_id);
     inedges[tgt].push_back(edge_id);
     return edge_id;
@@ -37,17 +52,17 @@ public:
     return edge_list.size();
   }
 
-  size_t source(size_t e) const {
+  index_type source(size_t e) const {
     return edge_list[e].first;
   }
-  size_t target(size_t e) const {
+  index_type target(size_t e) const {
     return edge_list[e].second;
   }
 
-  const std::vector<size_t>& out_edges(size_t v) const {
+  const std::vector<index_type>& out_edges(size_t v) const {
     return outedges[v];
   }
-  const std::vector<size_t>& in_edges(size_t v) const {
+  const std::vector<index_type>& in_edges(size_t v) const {
     return inedges[v];
   }
 
@@ -59,6 +74,10 @@ public:
   }
 };
 
+/// \brief Directed graph using \c size_t descriptors.
+///
+using directed_graph = basic_directed_graph<>;
+
 } // end namespace cpl
 
 #endif // Header guard
@@ -8,64 +8,53 @@
 #ifndef CPL_GRAPH_EDMONS_KARP_MAX_FLOW_HPP
 #define CPL_GRAPH_EDMONS_KARP_MAX_FLOW_HPP
 
-#include <algorithm>   // min
-#include <cstddef>     // size_t
-#include <cstdint>     // SIZE_MAX
-#include <limits>      // numeric_limits
-#include <queue>       // queue
-#include <type_traits> // is_arithmetic
-#include <vector>      // vector
+#include <cpl/graph/flow_network.hpp> // flow_network
+#include <algorithm>                  // min
+#include <cstddef>                    // size_t
+#include <limits>                     // numeric_limits
+#include <type_traits>                // is_arithmetic
+#include <vector>                     // vector
 
 namespace cpl {
 
-/// \brief Solves the maximum flow problem using the Edmonds-Karp algorithm.
-///
-/// This algorithm requires that each edge in the graph has its own reverse
-/// edge. Reversed edges that were not intended to be part of the modeled graph
-/// should have a capacity of 0. If \c g is a multigraph, each edge
-/// <tt>(u, v)</tt> must have its own counterpart <tt>(v, u)</tt>.
-///
-/// \param g The target graph.
-/// \param source The source vertex.
-/// \param target The target vertex.
-/// \param rev_edge The reverse edge map.
-/// \param capacity The capacity map.
-/// \param[out] residual The residual capacity map. The unused capacity of each
-/// edge will be recorded in this map. The final flow of each edge \c e can be
-/// obtained as <tt>capacity[e] - residual[e]</tt>.
-///
-/// \returns The maximum possible flow from \p source to \p target.
-///
-/// \pre <tt>source != target</tt>
-///
-/// \par Complexity
-/// At most O(V * E^2) memory accesses.
-///
-template <typename Graph, typename Flow>
-Flow edmonds_karp_max_flow(const Graph& g, const size_t source,
-                           const size_t target,
-                           const std::vector<size_t>& rev_edge,
-                           const std::vector<Flow>& capacity,
-                           std::vector<Flow>& residual) {
+namespace detail {
+
+// Scratch buffers of edmonds_karp_run, which can be kept between calls.
+template <typename Index>
+struct edmonds_karp_workspace {
+  std::vector<unsigned> last_bfs;
+  std::vector<Index> pred;
+  std::vector<Index> bfs_queue;
+};
+
+// Runs the algorithm from the residual capacities stored in 'residual'.
+// Both maps are accessed through operator[], so they can be vectors or the
+// maps of a flow_network.
+template <typename Flow, typename Graph, typename RevEdgeMap,
+          typename ResidualMap, typename Index>
+Flow edmonds_karp_run(const Graph& g, const size_t source, const size_t target,
+                      const RevEdgeMap& rev_edge, ResidualMap& residual,
+                      edmonds_karp_workspace<Index>& workspace) {
 
   static_assert(std::is_arithmetic<Flow>::value, "'Flow' must be arithmetic.");
-  using edge_id = size_t;
+  const auto nil = std::numeric_limits<Index>::max();
 
   // last_bfs[v] stores the the last BFS tree that vertex v was part of.  Note
   // that the source vertex is present in all BFS trees as it is the root.
-  std::vector<unsigned> last_bfs(g.num_vertices());
-  std::vector<edge_id> pred(g.num_vertices(), SIZE_MAX);
+  auto& last_bfs = workspace.last_bfs;
+  auto& pred = workspace.pred;
+  auto& bfs_queue = workspace.bfs_queue;
+  last_bfs.assign(g.num_vertices(), 0);
+  pred.assign(g.num_vertices(), nil);
 
   auto find_path = [&, source, target] {
-    std::queue<size_t> bfs_queue;
-    bfs_queue.push(source);
+    bfs_queue.assign(1, static_cast<Index>(source));
     const auto current_bfs = ++last_bfs[source];
 
-    while (!bfs_queue.empty()) {
-      const size_t curr = bfs_queue.front();
-      bfs_queue.pop();
+    for (size_t head = 0; head != bfs_queue.size(); ++head) {
+      const Index curr = bfs_queue[head];
       for (const auto edge : g.out_edges(curr)) {
-        const size_t child = g.target(edge);
+        const Index child = g.target(edge);
         if (last_bfs[child] == current_bfs)
           continue; // Already in the tree.
         if (!residual[edge])
@@ -73,7 +62,7 @@ Flow edmonds_karp_max_flow(const Graph& g, const size_t source,
         pred[child] = edge;
         if (child == target)
           return true;
-        bfs_queue.push(child);
+        bfs_queue.push_back(child);
         last_bfs[child] = current_bfs;
       }
     }
@@ -81,13 +70,12 @@ Flow edmonds_karp_max_flow(const Graph& g, const size_t source,
   };
 
   Flow total_flow = 0;
-  residual = capacity;
   while (find_path()) {
     Flow path_flow = std::numeric_limits<Flow>::max();
-    for (auto e = pred[target]; e != SIZE_MAX; e = pred[g.source(e)]) {
+    for (auto e = pred[target]; e != nil; e = pred[g.source(e)]) {
       path_flow = std::min(path_flow, residual[e]);
     }
-    for (auto e = pred[target]; e != SIZE_MAX; e = pred[g.source(e)]) {
+    for (auto e = pred[target]; e != nil; e = pred[g.source(e)]) {
       residual[e] -= path_flow;
       residual[rev_edge[e]] += path_flow;
     }
@@ -96,6 +84,91 @@ Flow edmonds_karp_max_flow(const Graph& g, const size_t source,
   return total_flow;
 }
 
+} // end namespace detail
+
+/// \brief Solves the maximum flow problem using the Edmonds-Karp algorithm.
+///
+/// This algorithm requires that each edge in the graph has its own reverse
+/// edge. Reversed edges that were not intended to be part of the modeled graph
+/// should have a capacity of 0. If \c g is a multigraph, each edge
+/// <tt>(u, v)</tt> must have its own counterpart <tt>(v, u)</tt>.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param target The target vertex.
+/// \param rev_edge The reverse edge map.
+/// \param capacity The capacity map.
+/// \param[out] residual The residual capacity map. The unused capacity of each
+/// edge will be recorded in this map. The final flow of each edge \c e can be
+/// obtained as <tt>capacity[e] - residual[e]</tt>.
+///
+/// \returns The maximum possible flow from \p source to \p target.
+///
+/// \pre <tt>source != target</tt>
+///
+/// \par Complexity
+/// At most O(V * E^2) memory accesses.
+///
+/// \sa dinic_max_flow, push_relabel_max_flow
+///
+template <typename Graph, typename Flow>
+Flow edmonds_karp_max_flow(
+    const Graph& g, const size_t source, const size_t target,
+    const std::vector<typename Graph::index_type>& rev_edge,
+    const std::vector<Flow>& capacity, std::vector<Flow>& residual) {
+  residual = capacity;
+  detail::edmonds_karp_workspace<typename Graph::index_type> workspace;
+  return detail::edmonds_karp_run<Flow>(g, source, target, rev_edge, residual,
+                                        workspace);
+}
+
+/// \brief Overload of \c edmonds_karp_max_flow which works directly on a
+/// \c flow_network. The residual capacities of \p net are reset before
+/// solving and hold the final residual capacities afterwards.
+///
+template <typename Flow, typename Index>
+Flow edmonds_karp_max_flow(flow_network<Flow, Index>& net, const size_t source,
+                           const size_t target) {
+  net.reset();
+  auto residual = net.residual_capacity_map();
+  detail::edmonds_karp_workspace<Index> workspace;
+  return detail::edmonds_karp_run<Flow>(net, source, target, net.rev_edge_map(),
+                                        residual, workspace);
+}
+
+/// \brief Function object which solves max-flow problems like
+/// \c edmonds_karp_max_flow. It can be used to select the max-flow algorithm
+/// of \c min_st_cut and \c gusfield_all_pairs_min_cut.
+///
+/// The engine keeps its scratch buffers between calls, so solving many
+/// problems with the same engine only allocates memory for the first one (or
+/// when a bigger graph comes). An engine must not be shared by threads.
+///
+class edmonds_karp_engine {
+  detail::edmonds_karp_workspace<size_t> workspace;
+
+public:
+  template <typename Graph, typename Flow>
+  Flow operator()(const Graph& g, const size_t source, const size_t target,
+                  const std::vector<typename Graph::index_type>& rev_edge,
+                  const std::vector<Flow>& capacity,
+                  std::vector<Flow>& residual) {
+    residual = capacity;
+    return detail::edmonds_karp_run<Flow>(g, source, target, rev_edge,
+                                          residual, workspace);
+  }
+
+  template <typename Flow, typename Index>
+  Flow operator()(flow_network<Flow, Index>& net, const size_t source,
+                  const size_t target) {
+    net.reset();
+    auto residual = net.residual_capacity_map();
+    return detail::edmonds_karp_run<Flow>(net, source, target,
+                                          net.rev_edge_map(), residual,
+                                          workspace);
+  }
+};
+
 } // end namespace cpl
 
 #endif // Header guard
@@ -0,0 +1,193 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the Edmonds' blossom algorithm.
+
+#ifndef CPL_GRAPH_EDMONDS_MAXIMUM_MATCHING_HPP
+#define CPL_GRAPH_EDMONDS_MAXIMUM_MATCHING_HPP
+
+#include <cstddef> // size_t
+#include <limits>  // numeric_limits
+#include <vector>  // vector
+
+namespace cpl {
+
+/// \brief Finds the maximum cardinality matching in an undirected graph.
+///
+/// This is the Edmonds' blossom algorithm. An alternating BFS tree is grown
+/// from each free vertex. When an edge joins two outer vertices of the tree,
+/// the odd cycle it closes (a blossom) is contracted into its base, so the
+/// search can continue as in the bipartite case. Augmenting paths are then
+/// expanded through the contracted blossoms.
+///
+/// A greedy matching is taken first. Blossom bases are tracked with a
+/// disjoint set forest, only the vertices touched by each search are reset
+/// before the next one, and the vertices of a failed search are never
+/// visited again.
+///
+/// \param g The target graph.
+/// \param[out] mate The vertex matched with each vertex, or
+/// <tt>std::numeric_limits<index_type>::max()</tt> for unmatched vertices.
+///
+/// \returns The number of edges in the matching.
+///
+/// \par Complexity
+/// <tt>O(V^3)</tt>. A search may contract <tt>O(V)</tt> blossoms, each one
+/// walking <tt>O(V)</tt> bases, so it takes <tt>O(V^2 + E)</tt> time. Failed
+/// searches take <tt>O(E * log(V))</tt> time in total.
+///
+/// \sa hopcroft_karp_maximum_matching
+///
+template <typename Graph>
+std::size_t
+edmonds_maximum_matching(const Graph& g,
+                         std::vector<typename Graph::index_type>& mate) {
+  using index_type = typename Graph::index_type;
+  const size_t num_vertices = g.num_vertices();
+  const auto nil = std::numeric_limits<index_type>::max();
+  auto other = [&](const index_type e, const index_type u) {
+    return (u == g.source(e)) ? g.target(e) : g.source(e);
+  };
+
+  mate.assign(num_vertices, nil);
+  size_t num_matching = 0;
+  for (size_t v = 0; v != num_vertices; ++v) {
+    if (mate[v] != nil)
+      continue;
+    for (const auto e : g.out_edges(v)) {
+      const index_type u = other(e, static_cast<index_type>(v));
+      if (u != v && mate[u] == nil) {
+        mate[u] = static_cast<index_type>(v);
+        mate[v] = u;
+        ++num_matching;
+        break;
+      }
+    }
+  }
+
+  // Contracted blossoms are kept in a disjoint set forest whose roots are
+  // the blossom bases.
+  std::vector<index_type> parent(num_vertices, nil); // In the search tree.
+  std::vector<index_type> base(num_vertices);
+  std::vector<bool> outer(num_vertices, false);
+  std::vector<bool> removed(num_vertices, false);
+  std::vector<size_t> lca_mark(num_vertices, 0);
+  size_t lca_stamp = 0;
+  std::vector<index_type> queue, touched;
+  for (size_t v = 0; v != num_vertices; ++v)
+    base[v] = static_cast<index_type>(v);
+
+  auto find_base = [&](index_type v) {
+    index_type root = v;
+    while (base[root] != root)
+      root = base[root];
+    while (base[v] != root) {
+      const index_type next = base[v];
+      base[v] = root;
+      v = next;
+    }
+    return root;
+  };
+
+  auto make_outer = [&](const index_type v) {
+    outer[v] = true;
+    queue.push_back(v);
+    touched.push_back(v);
+  };
+
+  auto lowest_common_ancestor = [&](index_type a, index_type b) {
+    ++lca_stamp;
+    while (true) {
+      a = find_base(a);
+      lca_mark[a] = lca_stamp;
+      if (mate[a] == nil)
+        break; // Reached the root.
+      a = parent[mate[a]];
+    }
+    while (true) {
+      b = find_base(b);
+      if (lca_mark[b] == lca_stamp)
+        return b;
+      b = parent[mate[b]];
+    }
+  };
+
+  // Walks the path from 'v' up to 'lca', making it traversable in the
+  // opposite direction through 'child'. Inner vertices on the path become
+  // outer, and the bases on the path are collected to be merged afterwards.
+  std::vector<index_type> blossom_bases;
+  auto mark_path = [&](index_type v, const index_type lca, index_type child) {
+    while (find_base(v) != lca) {
+      const index_type inner = mate[v];
+      parent[v] = child;
+      child = inner;
+      if (!outer[inner])
+        make_outer(inner);
+      blossom_bases.push_back(find_base(v));
+      blossom_bases.push_back(find_base(inner));
+      v = parent[inner];
+    }
+  };
+
+  // Returns the free vertex at the end of an augmenting path, or nil.
+  auto find_path = [&](const index_type root) {
+    make_outer(root);
+    for (size_t head = 0; head != queue.size(); ++head) {
+      const index_type v = queue[head];
+      for (const auto e : g.out_edges(v)) {
+        const index_type u = other(e, v);
+        if (removed[u] || mate[v] == u || find_base(v) == find_base(u))
+          continue;
+        if (outer[u]) {
+          const index_type lca = lowest_common_ancestor(v, u);
+          mark_path(v, lca, u);
+          mark_path(u, lca, v);
+          for (const index_type b : blossom_bases)
+            base[b] = lca;
+          blossom_bases.clear();
+        } else if (parent[u] == nil) {
+          parent[u] = v;
+          touched.push_back(u);
+          if (mate[u] == nil)
+            return u;
+          make_outer(mate[u]);
+        }
+      }
+    }
+    return nil;
+  };
+
+  for (size_t root = 0; root != num_vertices; ++root) {
+    if (mate[root] != nil || removed[root])
+      continue;
+    index_type v = find_path(static_cast<index_type>(root));
+    const bool found = v != nil;
+    if (found)
+      ++num_matching;
+    while (v != nil) {
+      const index_type pv = parent[v];
+      const index_type next = mate[pv];
+      mate[v] = pv;
+      mate[pv] = v;
+      v = next;
+    }
+
+    // A search tree without augmenting paths is never part of one later
+    // (the Hungarian tree lemma), so its vertices are left out for good.
+    for (const index_type w : touched) {
+      parent[w] = nil;
+      base[w] = w;
+      outer[w] = false;
+      removed[w] = !found;
+    }
+    queue.clear();
+    touched.clear();
+  }
+  return num_matching;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
@@ -0,0 +1,147 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Defines a directed graph which stores capacities and residual
+/// capacities along with its edges.
+
+#ifndef CPL_GRAPH_FLOW_NETWORK_HPP
+#define CPL_GRAPH_FLOW_NETWORK_HPP
+
+#include <cstddef>     // size_t
+#include <type_traits> // is_arithmetic, is_integral, is_unsigned
+#include <vector>      // vector
+
+namespace cpl {
+
+/// \brief Adjacency list which represents flow networks.
+///
+/// Each call to \c add_edge inserts an edge and its reverse edge with
+/// consecutive descriptors, so the reverse of edge \c e is <tt>e ^ 1</tt> and
+/// no reverse-edge map is needed. The target, the capacity and the residual
+/// capacity of each edge are stored together, so a max-flow algorithm
+/// touches a single array when it scans the out-edges of a vertex.
+///
+/// The max-flow algorithms of this library (and the algorithms built on top
+/// of them) accept a \c flow_network directly. They store their result in
+/// the residual capacities of the network, which can be restored with
+/// \c reset to solve again.
+///
+/// \tparam Flow Arithmetic type of the capacities.
+/// \tparam Index Unsigned integer type used to store vertex and edge
+/// descriptors.
+///
+template <typename Flow, typename Index = size_t>
+class flow_network {
+  static_assert(std::is_arithmetic<Flow>::value, "'Flow' must be arithmetic.");
+  static_assert(std::is_integral<Index>::value &&
+                    std::is_unsigned<Index>::value,
+                "'Index' must be an unsigned integer type.");
+
+public:
+  using index_type = Index;
+  using flow_type = Flow;
+
+private:
+  struct arc {
+    index_type head;
+    Flow capacity;
+    Flow residual;
+  };
+
+  std::vector<std::vector<index_type>> outedges;
+  std::vector<arc> arcs;
+
+public:
+  /// \brief Reverse-edge map of the network, usable wherever a \c rev_edge
+  /// vector is expected.
+  struct reverse_map {
+    index_type operator[](size_t e) const {
+      return static_cast<index_type>(e ^ 1);
+    }
+  };
+
+  /// \brief Mutable view of the residual capacities, usable wherever a
+  /// \c residual vector is expected.
+  class residual_map {
+    std::vector<arc>* arcs;
+
+  public:
+    explicit residual_map(std::vector<arc>& a) : arcs(&a) {}
+    Flow& operator[](size_t e) const {
+      return (*arcs)[e].residual;
+    }
+  };
+
+  explicit flow_network(size_t n_verts) : outedges(n_verts) {}
+
+  /// \brief Adds the edge <tt>(src, tgt)</tt> with capacity \p cap and its
+  /// reverse edge with capacity \p rev_cap.
+  ///
+  /// \returns The descriptor of the edge <tt>(src, tgt)</tt>. The descriptor of
+  /// the reverse edge is the returned value plus one.
+  ///
+  index_type add_edge(size_t src, size_t tgt, Flow cap, Flow rev_cap = 0) {
+    const auto edge_id = static_cast<index_type>(arcs.size());
+    arcs.push_back({static_cast<index_type>(tgt), cap, cap});
+    arcs.push_back({static_cast<index_type>(src), rev_cap, rev_cap});
+    outedges[src].push_back(edge_id);
+    outedges[tgt].push_back(static_cast<index_type>(edge_id + 1));
+    return edge_id;
+  }
+
+  size_t num_vertices() const {
+    return outedges.size();
+  }
+  size_t num_edges() const {
+    return arcs.size();
+  }
+
+  index_type source(size_t e) const {
+    return arcs[e ^ 1].head;
+  }
+  index_type target(size_t e) const {
+    return arcs[e].head;
+  }
+  index_type reverse(size_t e) const {
+    return static_cast<index_type>(e ^ 1);
+  }
+
+  const std::vector<index_type>& out_edges(size_t v) const {
+    return outedges[v];
+  }
+  size_t out_degree(size_t v) const {
+    return outedges[v].size();
+  }
+
+  Flow capacity(size_t e) const {
+    return arcs[e].capacity;
+  }
+  Flow residual(size_t e) const {
+    return arcs[e].residual;
+  }
+
+  /// \brief Returns the flow through edge \p e, which is negative when flow
+  /// goes through its reverse edge.
+  Flow flow(size_t e) const {
+    return arcs[e].capacity - arcs[e].residual;
+  }
+
+  /// \brief Restores the residual capacity of every edge to its capacity.
+  void reset() {
+    for (auto& a : arcs)
+      a.residual = a.capacity;
+  }
+
+  reverse_map rev_edge_map() const {
+    return {};
+  }
+  residual_map residual_capacity_map() {
+    return residual_map(arcs);
+  }
+};
+
+} // end namespace cpl
+
+#endif // Header guard
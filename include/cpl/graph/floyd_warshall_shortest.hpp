@@ -6,15 +6,42 @@
 #ifndef CPL_GRAPH_FLOYD_WARSHALL_SHORTEST_HPP
 #define CPL_GRAPH_FLOYD_WARSHALL_SHORTEST_HPP
 
-#include <cpl/utility/matrix.hpp> // matrix
-#include <algorithm>              // min
-#include <cstddef>                // size_t
-#include <cstdint>                // SIZE_MAX
-#include <limits>                 // numeric_limits
-#include <vector>                 // vector
+#include <cpl/utility/matrix.hpp>   // matrix
+#include <cpl/utility/parallel.hpp> // parallel_for
+#include <algorithm>                // min
+#include <cassert>                  // assert
+#include <cstddef>                  // size_t
+#include <limits>                   // numeric_limits
+#include <vector>                   // vector
 
 namespace cpl {
 
+namespace detail {
+
+// Fills the matrices with the paths of at most one edge.
+template <typename Graph, typename Distance>
+void floyd_warshall_init(const Graph& g, const std::vector<Distance>& weight,
+                         matrix<Distance>& dist,
+                         matrix<typename Graph::index_type>& next) {
+  using index_type = typename Graph::index_type;
+  const size_t num_edges = g.num_edges();
+  const size_t num_v = g.num_vertices();
+  dist.assign({num_v, num_v}, std::numeric_limits<Distance>::max());
+  next.assign({num_v, num_v}, std::numeric_limits<index_type>::max());
+
+  for (size_t v = 0; v != num_v; ++v)
+    dist[v][v] = 0;
+
+  for (size_t e = 0; e != num_edges; ++e) {
+    const index_type u = g.source(e);
+    const index_type v = g.target(e);
+    dist[u][v] = std::min(dist[u][v], weight[e]);
+    next[u][v] = v;
+  }
+}
+
+} // end namespace detail
+
 /// \brief Finds the shortest-distance for each pair of vertices in a directed
 /// edge-weighted graph.
 ///
@@ -42,23 +69,11 @@ namespace cpl {
 template <typename Graph, typename Distance>
 void floyd_warshall_all_pairs_shortest_paths(
     const Graph& g, const std::vector<Distance>& weight, matrix<Distance>& dist,
-    matrix<size_t>& next) {
+    matrix<typename Graph::index_type>& next) {
 
   const Distance inf = std::numeric_limits<Distance>::max();
-  const size_t num_edges = g.num_edges();
   const size_t num_v = g.num_vertices();
-  dist.assign({num_v, num_v}, inf);
-  next.assign({num_v, num_v}, SIZE_MAX);
-
-  for (size_t v = 0; v != num_v; ++v)
-    dist[v][v] = 0;
-
-  for (size_t e = 0; e != num_edges; ++e) {
-    const size_t u = g.source(e);
-    const size_t v = g.target(e);
-    dist[u][v] = std::min(dist[u][v], weight[e]);
-    next[u][v] = v;
-  }
+  detail::floyd_warshall_init(g, weight, dist, next);
 
   auto try_update = [&](size_t k, size_t i, size_t j) {
     if (dist[i][k] + dist[k][j] >= dist[i][j])
@@ -79,6 +94,104 @@ void floyd_warshall_all_pairs_shortest_paths(
   }     // 1st for
 }
 
+/// \brief Finds the shortest-distance for each pair of vertices in a directed
+/// edge-weighted graph, using a cache-friendly evaluation order.
+///
+/// The matrices are split in square tiles of \p block_size rows. For each
+/// diagonal tile, the algorithm relaxes the paths through its vertices in
+/// three phases: first inside the diagonal tile, then in the tiles sharing its
+/// rows or columns and finally in the remaining tiles. Each phase only reads
+/// tiles finished by previous phases, so the working set fits in cache, and
+/// the tiles of the last two phases are independent of each other. Those
+/// two phases split their tiles by rows or columns of tiles among
+/// \p num_threads threads.
+///
+/// \param g The target graph.
+/// \param weight Edge-weight map.
+/// \param[out] dist Vertex-distance matrix, as in
+/// \c floyd_warshall_all_pairs_shortest_paths.
+/// \param[out] next Auxiliary matrix used to reconstruct paths, as in
+/// \c floyd_warshall_all_pairs_shortest_paths. If there are several shortest
+/// paths between two vertices, the chosen one may differ.
+/// \param block_size Number of rows and columns of each tile.
+/// \param num_threads The number of threads to use.
+///
+/// \pre The graph \p g must have no negative cycle.
+///
+/// \par Complexity
+/// The time complexity is <tt>O(V^3)</tt>.
+///
+template <typename Graph, typename Distance>
+void blocked_floyd_warshall_all_pairs_shortest_paths(
+    const Graph& g, const std::vector<Distance>& weight, matrix<Distance>& dist,
+    matrix<typename Graph::index_type>& next, const size_t block_size = 64,
+    const size_t num_threads = 1) {
+  assert(block_size > 0);
+  const Distance inf = std::numeric_limits<Distance>::max();
+  const size_t num_v = g.num_vertices();
+  const size_t num_blocks = (num_v + block_size - 1) / block_size;
+  detail::floyd_warshall_init(g, weight, dist, next);
+
+  // Relaxes the entries of the tile [i0, i1) x [j0, j1) through the vertices
+  // in [k0, k1).
+  auto relax_tile = [&](size_t i0, size_t i1, size_t j0, size_t j1,
+                        size_t k0, size_t k1) {
+    for (size_t k = k0; k != k1; ++k) {
+      const auto dist_k = dist[k];
+      for (size_t i = i0; i != i1; ++i) {
+        const Distance dist_ik = dist[i][k];
+        if (dist_ik == inf)
+          continue;
+        const auto dist_i = dist[i];
+        const auto next_i = next[i];
+        const auto next_ik = next_i[k];
+        for (size_t j = j0; j != j1; ++j) {
+          if (dist_k[j] != inf && dist_ik + dist_k[j] < dist_i[j]) {
+            dist_i[j] = dist_ik + dist_k[j];
+            next_i[j] = next_ik;
+          }
+        }
+      }
+    }
+  };
+
+  for (size_t k0 = 0; k0 < num_v; k0 += block_size) {
+    const size_t k1 = std::min(k0 + block_size, num_v);
+    relax_tile(k0, k1, k0, k1, k0, k1);
+
+    // Each task handles a range of tile positions 'b', which are the columns
+    // of tiles in the same rows and the rows of tiles in the same columns.
+    parallel_for(num_blocks, num_threads,
+                 [&](size_t, const size_t first, const size_t last) {
+                   for (size_t b = first; b != last; ++b) {
+                     const size_t b0 = b * block_size;
+                     const size_t b1 = std::min(b0 + block_size, num_v);
+                     if (b0 == k0)
+                       continue;
+                     relax_tile(k0, k1, b0, b1, k0, k1); // Same rows.
+                     relax_tile(b0, b1, k0, k1, k0, k1); // Same columns.
+                   }
+                 });
+
+    // Each task handles a range of rows of tiles.
+    parallel_for(num_blocks, num_threads,
+                 [&](size_t, const size_t first, const size_t last) {
+                   for (size_t i = first; i != last; ++i) {
+                     const size_t i0 = i * block_size;
+                     if (i0 == k0)
+                       continue;
+                     const size_t i1 = std::min(i0 + block_size, num_v);
+                     for (size_t j0 = 0; j0 < num_v; j0 += block_size) {
+                       if (j0 == k0)
+                         continue;
+                       relax_tile(i0, i1, j0, std::min(j0 + block_size, num_v),
+                                  k0, k1);
+                     }
+                   }
+                 });
+  }
+}
+
 /// \brief Reconstruct the shortest path between two vertices using the data
 /// generated by the Floyd-Warshall algorithm.
 ///
@@ -96,10 +209,10 @@ void floyd_warshall_all_pairs_shortest_paths(
 /// \par Complexity
 /// Linear in the number of vertices on the reconstructed path.
 ///
-template <typename OutputIt>
+template <typename Index, typename OutputIt>
 OutputIt floyd_warshall_path(size_t u, const size_t v,
-                             const matrix<size_t>& next, OutputIt out_it) {
-  if (u != v && next[u][v] == SIZE_MAX)
+                             const matrix<Index>& next, OutputIt out_it) {
+  if (u != v && next[u][v] == std::numeric_limits<Index>::max())
     return out_it;
   *out_it++ = u;
   while (u != v) {
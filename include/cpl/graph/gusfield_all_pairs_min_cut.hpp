@@ -6,21 +6,84 @@
 #ifndef CPL_GRAPH_GUSFIELD_ALL_PAIRS_MIN_CUT_HPP
 #define CPL_GRAPH_GUSFIELD_ALL_PAIRS_MIN_CUT_HPP
 
+#include <cpl/graph/flow_network.hpp>
 #include <cpl/graph/min_st_cut.hpp>
 #include <cpl/utility/matrix.hpp>
+#include <cpl/utility/parallel.hpp>
 
-#include <algorithm> // min
+#include <algorithm> // min, max
 #include <cstddef>   // size_t
 #include <limits>    // numeric_limits
 #include <vector>    // vector
 
 namespace cpl {
 
-/// \brief Computes all min-cut pairs for an undirected graph by constructing
-/// the Gomory-Hu tree.
+namespace detail {
+
+// Builds the tree. 'min_st_cut_fn(worker, s, t, source_side)' must return the
+// min s-t cut and mark its source side using only the state of 'worker', which
+// is below 'num_workers'. Calls for different workers run concurrently.
+//
+// Step i cuts i from parent[i] and may only change the parents of later
+// vertices. So the cuts of a window of pending vertices are computed
+// concurrently with the parents known so far, and then applied in order until
+// one whose parent changed meanwhile, which is computed again in the next
+// window. The source side found through the residual graph is the same for
+// every max flow, so the tree does not depend on the number of workers.
+template <typename Flow, typename Index, typename MinCut>
+void gusfield_run(const size_t num_vertices, const size_t num_workers,
+                  MinCut min_st_cut_fn, std::vector<Index>& parent,
+                  std::vector<Flow>& weight) {
+  parent.assign(num_vertices, 0);
+  weight.assign(num_vertices, std::numeric_limits<Flow>::max());
+
+  // Vertex v uses the slot v % window, so the slots of a window differ.
+  const size_t window = std::max(num_workers, size_t{1});
+  std::vector<size_t> slot_vertex(window, 0); // 0 if the slot is unused.
+  std::vector<Index> slot_parent(window);
+  std::vector<Flow> slot_cut(window);
+  std::vector<std::vector<bool>> source_side(window);
+  std::vector<size_t> pending;
+  auto compute = [&](const size_t worker, const size_t first,
+                     const size_t end) {
+    for (size_t k = first; k != end; ++k) {
+      const size_t v = pending[k], slot = v % window;
+      slot_vertex[slot] = v;
+      slot_parent[slot] = parent[v];
+      slot_cut[slot] =
+          min_st_cut_fn(worker, v, parent[v], source_side[slot]);
+    }
+  };
+
+  for (size_t next = 1; next < num_vertices;) {
+    const size_t last = std::min(next + window, num_vertices);
+    pending.clear();
+    for (size_t v = next; v != last; ++v)
+      if (slot_vertex[v % window] != v || slot_parent[v % window] != parent[v])
+        pending.push_back(v);
+    parallel_for(pending.size(), num_workers, compute);
+
+    // The parent of 'next' is final, so at least one cut is applied.
+    for (; next != last; ++next) {
+      const size_t slot = next % window;
+      if (slot_parent[slot] != parent[next])
+        break;
+      weight[next] = slot_cut[slot];
+      for (size_t j = next + 1; j != num_vertices; ++j)
+        if (source_side[slot][j] && parent[j] == parent[next])
+          parent[j] = static_cast<Index>(next);
+    }
+  }
+}
+
+} // end namespace detail
+
+/// \brief Computes the Gomory-Hu tree of an undirected graph.
 ///
 /// This function implements the Gusfield Algorithm. It constructs the Gomory-Hu
 /// tree without any vertex contraction so it is very efficient in practice.
+/// The min s-t cut between any pair of vertices is the lightest edge in the
+/// path that joins them in the tree.
 ///
 /// The Gomory-Hu tree is a structure used to compute min-cut pairs in an
 /// undirected graph, but for the sake of simplicity, this implementation
@@ -28,44 +91,160 @@ namespace cpl {
 /// bidirectional iff the capacity of each edge is equal to the capacity of its
 /// reversed edge.
 ///
+/// Each thread owns a \p MaxFlow engine, along with its workspace, and its
+/// residual and source side buffers, which are reused across its max-flow
+/// computations. The cuts of the next \p num_threads vertices are computed
+/// concurrently and applied in order, so the tree does not depend on
+/// \p num_threads. A cut is computed again when a previous one changes the
+/// tree edge it was computed for.
+///
+/// \tparam MaxFlow Function object type which computes the max flow. See
+/// \c min_st_cut.
+///
 /// \param g The target graph.
 /// \param rev_edge The reverse edge map.
 /// \param capacity The capacity (or weight) map.
+/// \param[out] parent The parent of each vertex in the tree. Vertex 0 is the
+/// root, and <tt>parent[v] < v</tt> for every other vertex \c v.
+/// \param[out] weight The weight of the tree edge between each vertex \c v
+/// and <tt>parent[v]</tt>, which is the min cut between them. The weight of
+/// the root is set to <tt>std::numeric_limits<Flow>::max()</tt>.
+/// \param num_threads The number of threads to use.
+///
+/// \par Complexity
+/// Exactly <tt>V - 1</tt> max-flow operations with one thread, plus
+/// <tt>O(V^2)</tt> to update the tree. With \c T threads, at most \c T cuts
+/// are computed per applied one. <tt>O(T * (V + E))</tt> memory is used.
+///
+/// \sa gomory_hu_cut_matrix
+///
+template <typename MaxFlow = edmonds_karp_engine, typename Graph,
+          typename Flow>
+void gusfield_gomory_hu_tree(
+    const Graph& g, const std::vector<typename Graph::index_type>& rev_edge,
+    const std::vector<Flow>& capacity,
+    std::vector<typename Graph::index_type>& parent,
+    std::vector<Flow>& weight, const size_t num_threads = 1) {
+  const size_t num_workers = std::max(num_threads, size_t{1});
+  std::vector<MaxFlow> max_flow(num_workers);
+  std::vector<std::vector<Flow>> residual(num_workers);
+  detail::gusfield_run(
+      g.num_vertices(), num_workers,
+      [&](size_t worker, size_t s, size_t t, std::vector<bool>& source_side) {
+        const Flow flow = max_flow[worker](g, s, t, rev_edge, capacity,
+                                           residual[worker]);
+        detail::residual_reachable(g, s, residual[worker], source_side);
+        return flow;
+      },
+      parent, weight);
+}
+
+/// \brief Overload of \c gusfield_gomory_hu_tree which works directly on a
+/// \c flow_network. The residual capacities of \p net are overwritten.
+///
+/// One thread works on \p net, and each other thread on its own copy.
+///
+template <typename MaxFlow = edmonds_karp_engine, typename Flow,
+          typename Index>
+void gusfield_gomory_hu_tree(flow_network<Flow, Index>& net,
+                             std::vector<Index>& parent,
+                             std::vector<Flow>& weight,
+                             const size_t num_threads = 1) {
+  const size_t num_workers = std::max(num_threads, size_t{1});
+  std::vector<MaxFlow> max_flow(num_workers);
+  std::vector<flow_network<Flow, Index>> copies(num_workers - 1, net);
+  detail::gusfield_run(
+      net.num_vertices(), num_workers,
+      [&](size_t worker, size_t s, size_t t, std::vector<bool>& source_side) {
+        auto& worker_net = worker == 0 ? net : copies[worker - 1];
+        const Flow flow = max_flow[worker](worker_net, s, t);
+        detail::residual_reachable(worker_net, s,
+                                   worker_net.residual_capacity_map(),
+                                   source_side);
+        return flow;
+      },
+      parent, weight);
+}
+
+/// \brief Builds the matrix of min-cut pairs from a Gomory-Hu tree.
+///
+/// \param parent The parent of each vertex, as computed by
+/// \c gusfield_gomory_hu_tree.
+/// \param weight The weight of each tree edge, as computed by
+/// \c gusfield_gomory_hu_tree.
 ///
 /// \returns A matrix of flows \c cut where <tt>cut[{s, t}]</tt> evaluates to
 /// the min s-t cut between the vertices \c s and \c t (being \c s != \c t).
 ///
+/// \pre <tt>parent[v] < v</tt> for each vertex \c v other than 0.
+///
 /// \par Complexity
-/// Exactly <tt>V - 1</tt> min s-t cut operations.
-/// In the current implementation, the underlying min s-t cut uses the
-/// Edmonds-Karp max flow algorithm whichs has complexity <tt>O(V * E^2)</tt> so
-/// the overall complexity of this function in the  worst case is
-/// <tt>O(V^2 * E^2)</tt>.
-///
-template <typename Graph, typename Flow>
-matrix<Flow> gusfield_all_pairs_min_cut(const Graph& g,
-                                        const std::vector<size_t>& rev_edge,
-                                        const std::vector<Flow>& capacity) {
-
-  const size_t num_vertices = g.num_vertices();
-  std::vector<size_t> parent(num_vertices);
+/// <tt>O(V^2)</tt> time and memory.
+///
+template <typename Index, typename Flow>
+matrix<Flow> gomory_hu_cut_matrix(const std::vector<Index>& parent,
+                                  const std::vector<Flow>& weight) {
+  const size_t num_vertices = parent.size();
   matrix<Flow> cut({num_vertices, num_vertices},
                    std::numeric_limits<Flow>::max());
-
-  std::vector<bool> source_side;
   for (size_t i = 1; i != num_vertices; ++i) {
-    const Flow min_cut =
-        min_st_cut(g, i, parent[i], rev_edge, capacity, source_side);
-    for (size_t j = i + 1; j != num_vertices; ++j)
-      if (source_side[j] && parent[j] == parent[i])
-        parent[j] = i;
-    cut[i][parent[i]] = cut[parent[i]][i] = min_cut;
+    cut[i][parent[i]] = cut[parent[i]][i] = weight[i];
     for (size_t j = 0; j != i; ++j)
-      cut[i][j] = cut[j][i] = std::min(min_cut, cut[parent[i]][j]);
+      cut[i][j] = cut[j][i] = std::min(weight[i], cut[parent[i]][j]);
   }
   return cut;
 }
 
+/// \brief Computes all min-cut pairs for an undirected graph by constructing
+/// the Gomory-Hu tree.
+///
+/// Same as \c gusfield_gomory_hu_tree followed by \c gomory_hu_cut_matrix.
+/// Prefer using them directly on big graphs, where the matrix may not fit in
+/// memory.
+///
+/// \tparam MaxFlow Function object type which computes the max flow. See
+/// \c min_st_cut.
+///
+/// \param g The target graph.
+/// \param rev_edge The reverse edge map.
+/// \param capacity The capacity (or weight) map.
+/// \param num_threads The number of threads to use. The result does not
+/// depend on it. See \c gusfield_gomory_hu_tree.
+///
+/// \returns A matrix of flows \c cut where <tt>cut[{s, t}]</tt> evaluates to
+/// the min s-t cut between the vertices \c s and \c t (being \c s != \c t).
+///
+/// \par Complexity
+/// Exactly <tt>V - 1</tt> min s-t cut operations with one thread.
+/// By default, the underlying min s-t cut uses the Edmonds-Karp max flow
+/// algorithm whichs has complexity <tt>O(V * E^2)</tt> so the overall
+/// complexity of this function in the  worst case is <tt>O(V^2 * E^2)</tt>.
+///
+template <typename MaxFlow = edmonds_karp_engine, typename Graph,
+          typename Flow>
+matrix<Flow> gusfield_all_pairs_min_cut(
+    const Graph& g, const std::vector<typename Graph::index_type>& rev_edge,
+    const std::vector<Flow>& capacity, const size_t num_threads = 1) {
+  std::vector<typename Graph::index_type> parent;
+  std::vector<Flow> weight;
+  gusfield_gomory_hu_tree<MaxFlow>(g, rev_edge, capacity, parent, weight,
+                                   num_threads);
+  return gomory_hu_cut_matrix(parent, weight);
+}
+
+/// \brief Overload of \c gusfield_all_pairs_min_cut which works directly on
+/// a \c flow_network. The residual capacities of \p net are overwritten.
+///
+template <typename MaxFlow = edmonds_karp_engine, typename Flow,
+          typename Index>
+matrix<Flow> gusfield_all_pairs_min_cut(flow_network<Flow, Index>& net,
+                                        const size_t num_threads = 1) {
+  std::vector<Index> parent;
+  std::vector<Flow> weight;
+  gusfield_gomory_hu_tree<MaxFlow>(net, parent, weight, num_threads);
+  return gomory_hu_cut_matrix(parent, weight);
+}
+
 } // end namespace cpl
 
 #endif // Header guard
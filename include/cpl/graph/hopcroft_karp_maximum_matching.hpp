@@ -6,111 +6,257 @@
 #ifndef CPL_GRAPH_HOPCROFT_KARP_MAXIMUM_MATCHING_HPP
 #define CPL_GRAPH_HOPCROFT_KARP_MAXIMUM_MATCHING_HPP
 
-#include <cstddef>    // size_t
-#include <cstdint>    // SIZE_MAX
-#include <functional> // function
-#include <queue>      // queue
-#include <vector>     // vector
+#include <cpl/graph/bipartite.hpp> // is_bipartite
+#include <cassert>                 // assert
+#include <cstddef>                 // size_t
+#include <initializer_list>        // initializer_list
+#include <iterator>                // begin
+#include <limits>                  // numeric_limits
+#include <vector>                  // vector
 
 namespace cpl {
 
-/// \brief Finds the maximum cardinality matching in an undirected bipartite
-/// graph.
-///
-/// \param g The target graph.
-///
-/// Finds the maximum cardinality matching in the given graph. It is the maximum
-/// number of edges in an edge subset, such that no two edges share a common
-/// endpoint.
-///
-/// \returns The maximum cardinality matching.
-///
-/// \pre The graph \p g must be bipartite.
-///
-/// \par Complexity
-/// <tt>O(E * sqrt(V))</tt>.
-///
+namespace detail {
+
+// Greedy initial matching. A vertex with a single unmatched neighbor is
+// always matched with it, which is never worse than the optimum. Otherwise
+// an arbitrary edge is taken. Returns the number of matched pairs.
 template <typename Graph>
-std::size_t hopcroft_karp_maximum_matching(const Graph& g) {
-  // Note: pair_of can be used to query the selected pairs.
+size_t karp_sipser_matching(const Graph& g,
+                            std::vector<typename Graph::index_type>& pair_of) {
+  using index_type = typename Graph::index_type;
   const size_t num_vertices = g.num_vertices();
-  const size_t nil = num_vertices; // The null vertex
-  std::vector<size_t> pair_of(num_vertices, nil);
-  std::vector<size_t> dist(num_vertices + 1);
-  std::vector<size_t> set_a, set_b;
-
-  auto separate_vertices = [&] {
-    std::vector<signed char> color(num_vertices);
-    std::function<void(size_t)> dfs_visit;
-    dfs_visit = [&](const size_t u) {
-      color[u] == 1 ? set_a.push_back(u) : set_b.push_back(u);
-      for (const auto e : g.out_edges(u)) {
-        const size_t v = (u == g.source(e)) ? g.target(e) : g.source(e);
-        if (color[v])
-          continue;
-        color[v] = -color[u];
-        dfs_visit(v);
-      }
-    };
-    for (size_t v = 0; v < num_vertices; ++v) {
-      if (color[v] != 0)
+  const auto nil = static_cast<index_type>(num_vertices);
+  auto other = [&](const index_type e, const index_type u) {
+    return (u == g.source(e)) ? g.target(e) : g.source(e);
+  };
+
+  // Number of edges to unmatched vertices.
+  std::vector<index_type> degree(num_vertices);
+  std::vector<index_type> degree_one;
+  for (size_t v = 0; v != num_vertices; ++v) {
+    degree[v] = static_cast<index_type>(g.out_edges(v).size());
+    if (degree[v] == 1)
+      degree_one.push_back(static_cast<index_type>(v));
+  }
+
+  size_t num_matching = 0;
+  auto match_with_free_neighbor = [&](const index_type u) {
+    for (const auto e : g.out_edges(u)) {
+      const index_type v = other(e, u);
+      if (pair_of[v] != nil)
         continue;
-      color[v] = 1;
-      dfs_visit(v);
+      pair_of[u] = v;
+      pair_of[v] = u;
+      ++num_matching;
+      for (const index_type x : {u, v}) {
+        for (const auto f : g.out_edges(x)) {
+          const index_type y = other(f, x);
+          if (pair_of[y] == nil && --degree[y] == 1)
+            degree_one.push_back(y);
+        }
+      }
+      return;
+    }
+  };
+
+  size_t next = 0;
+  while (true) {
+    if (!degree_one.empty()) {
+      const index_type u = degree_one.back();
+      degree_one.pop_back();
+      if (pair_of[u] == nil && degree[u] == 1)
+        match_with_free_neighbor(u);
+      continue;
     }
+    while (next != num_vertices && (pair_of[next] != nil || degree[next] == 0))
+      ++next;
+    if (next == num_vertices)
+      break;
+    match_with_free_neighbor(static_cast<index_type>(next));
+  }
+  return num_matching;
+}
+
+template <typename Graph>
+size_t hopcroft_karp_run(const Graph& g, const std::vector<bool>& color,
+                         std::vector<typename Graph::index_type>& mate) {
+  using index_type = typename Graph::index_type;
+  const size_t num_vertices = g.num_vertices();
+  const auto nil = static_cast<index_type>(num_vertices); // The null vertex
+  const auto inf = std::numeric_limits<index_type>::max();
+  auto other = [&](const index_type e, const index_type u) {
+    return (u == g.source(e)) ? g.target(e) : g.source(e);
   };
+
+  std::vector<index_type> set_a;
+  for (size_t v = 0; v != num_vertices; ++v)
+    if (color[v])
+      set_a.push_back(static_cast<index_type>(v));
+
+  std::vector<index_type> pair_of(num_vertices, nil);
+  size_t num_matching = karp_sipser_matching(g, pair_of);
+
+  std::vector<index_type> dist(num_vertices + 1);
+  std::vector<index_type> queue;
+  queue.reserve(set_a.size());
   auto bfs = [&] {
-    std::queue<size_t> q;
-    for (const size_t a : set_a) {
+    queue.clear();
+    for (const index_type a : set_a) {
       if (pair_of[a] == nil) {
         dist[a] = 0;
-        q.push(a);
+        queue.push_back(a);
       } else
-        dist[a] = SIZE_MAX;
+        dist[a] = inf;
     }
-    dist[nil] = SIZE_MAX;
-    while (!q.empty()) {
-      const size_t a = q.front();
-      q.pop();
+    dist[nil] = inf;
+    for (size_t head = 0; head != queue.size(); ++head) {
+      const index_type a = queue[head];
       if (dist[a] >= dist[nil])
         continue;
       for (const auto e : g.out_edges(a)) {
-        const size_t b = (a == g.source(e)) ? g.target(e) : g.source(e);
-        if (dist[pair_of[b]] != SIZE_MAX)
+        const index_type b = other(e, a);
+        if (dist[pair_of[b]] != inf)
           continue;
-        dist[pair_of[b]] = dist[a] + 1;
-        q.push(pair_of[b]);
+        dist[pair_of[b]] = static_cast<index_type>(dist[a] + 1);
+        if (pair_of[b] != nil)
+          queue.push_back(pair_of[b]);
       }
     }
-    return dist[nil] != SIZE_MAX;
+    return dist[nil] != inf;
   };
-  std::function<bool(size_t)> dfs = [&](const size_t a) {
-    if (a == nil)
-      return true;
-    for (const auto e : g.out_edges(a)) {
-      const auto b = (a == g.source(e)) ? g.target(e) : g.source(e);
-      if (dist[pair_of[b]] != dist[a] + 1)
+
+  // Position of the next edge to try from each vertex in the current phase.
+  std::vector<size_t> current(num_vertices);
+  std::vector<index_type> stack;
+  auto dfs = [&](const index_type root) {
+    stack.assign(1, root);
+    while (!stack.empty()) {
+      const index_type a = stack.back();
+      const auto& edges = g.out_edges(a);
+      if (current[a] == edges.size()) { // Dead end.
+        dist[a] = inf;
+        stack.pop_back();
+        if (!stack.empty())
+          ++current[stack.back()];
         continue;
-      if (!dfs(pair_of[b]))
+      }
+
+      const index_type b = other(std::begin(edges)[current[a]], a);
+      const index_type next = pair_of[b];
+      if (dist[next] != static_cast<index_type>(dist[a] + 1)) {
+        ++current[a];
         continue;
-      pair_of[b] = a;
-      pair_of[a] = b;
+      }
+      if (next != nil) {
+        stack.push_back(next);
+        continue;
+      }
+
+      // Augmenting path found: each vertex in the stack takes the vertex its
+      // current edge points to.
+      for (const index_type u : stack) {
+        const index_type v = other(std::begin(g.out_edges(u))[current[u]], u);
+        pair_of[v] = u;
+        pair_of[u] = v;
+      }
       return true;
     }
-    dist[a] = SIZE_MAX;
     return false;
   };
 
-  separate_vertices();
-  size_t num_matching = 0;
   while (bfs()) {
-    for (const size_t a : set_a)
+    current.assign(num_vertices, 0);
+    for (const index_type a : set_a)
       if (pair_of[a] == nil && dfs(a))
         ++num_matching;
   }
+
+  mate.resize(num_vertices);
+  for (size_t v = 0; v != num_vertices; ++v)
+    mate[v] = pair_of[v] == nil ? inf : pair_of[v];
   return num_matching;
 }
 
+} // end namespace detail
+
+/// \brief Finds the maximum cardinality matching in an undirected bipartite
+/// graph with a known bipartition.
+///
+/// Finds the maximum cardinality matching in the given graph. It is the maximum
+/// number of edges in an edge subset, such that no two edges share a common
+/// endpoint.
+///
+/// The search starts from a greedy Karp-Sipser matching, which is often close
+/// to the maximum one. Augmenting paths are searched with explicit stacks, so
+/// long paths don't overflow the call stack.
+///
+/// \param g The target graph.
+/// \param color The side of each vertex. Every edge must join two vertices of
+/// different color, such as the ones computed by \c is_bipartite.
+/// \param[out] mate The vertex matched with each vertex, or
+/// <tt>std::numeric_limits<index_type>::max()</tt> for unmatched vertices.
+///
+/// \returns The number of edges in the matching.
+///
+/// \par Complexity
+/// <tt>O(E * sqrt(V))</tt>.
+///
+/// \sa edmonds_maximum_matching for non-bipartite graphs.
+///
+template <typename Graph>
+std::size_t
+hopcroft_karp_maximum_matching(const Graph& g, const std::vector<bool>& color,
+                               std::vector<typename Graph::index_type>& mate) {
+  return detail::hopcroft_karp_run(g, color, mate);
+}
+
+/// \brief Finds the maximum cardinality matching in an undirected bipartite
+/// graph.
+///
+/// Same as the overload which takes a bipartition, after computing one with
+/// \c is_bipartite.
+///
+/// \param g The target graph.
+/// \param[out] mate The vertex matched with each vertex, or
+/// <tt>std::numeric_limits<index_type>::max()</tt> for unmatched vertices.
+///
+/// \returns The number of edges in the matching.
+///
+/// \pre The graph \p g must be bipartite.
+///
+/// \par Complexity
+/// <tt>O(E * sqrt(V))</tt>.
+///
+template <typename Graph>
+std::size_t
+hopcroft_karp_maximum_matching(const Graph& g,
+                               std::vector<typename Graph::index_type>& mate) {
+  std::vector<bool> color;
+  const bool bipartite = is_bipartite(g, color);
+  assert(bipartite);
+  (void)bipartite;
+  return detail::hopcroft_karp_run(g, color, mate);
+}
+
+/// \brief Finds the size of the maximum cardinality matching in an undirected
+/// bipartite graph.
+///
+/// \param g The target graph.
+///
+/// \returns The number of edges in the maximum cardinality matching.
+///
+/// \pre The graph \p g must be bipartite.
+///
+/// \par Complexity
+/// <tt>O(E * sqrt(V))</tt>.
+///
+template <typename Graph>
+std::size_t hopcroft_karp_maximum_matching(const Graph& g) {
+  std::vector<typename Graph::index_type> mate;
+  return hopcroft_karp_maximum_matching(g, mate);
+}
+
 } // end namespace cpl
 
 #endif // Header guard
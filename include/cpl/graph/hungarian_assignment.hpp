@@ -0,0 +1,114 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the Hungarian algorithm for the assignment problem.
+
+#ifndef CPL_GRAPH_HUNGARIAN_ASSIGNMENT_HPP
+#define CPL_GRAPH_HUNGARIAN_ASSIGNMENT_HPP
+
+#include <cpl/utility/matrix.hpp> // matrix
+#include <cassert>                // assert
+#include <cstddef>                // size_t
+#include <limits>                 // numeric_limits
+#include <type_traits>            // is_arithmetic, is_signed
+#include <vector>                 // vector
+
+namespace cpl {
+
+/// \brief Solves the assignment problem using the Hungarian algorithm.
+///
+/// Each row is assigned to a different column, minimizing the total cost of
+/// the chosen cells. Rows are added one at a time: a Dijkstra-like search over
+/// the columns, driven by row and column potentials, finds the cheapest
+/// augmenting path for the new row.
+///
+/// \param cost The cost matrix. <tt>cost[i][j]</tt> is the cost of assigning
+/// row \c i to column \c j.
+/// \param[out] assignment The column assigned to each row.
+///
+/// \returns The total cost of the assignment.
+///
+/// \pre <tt>cost.num_rows() <= cost.num_cols()</tt>
+///
+/// \par Complexity
+/// <tt>O(N^2 * M)</tt> for \c N rows and \c M columns.
+///
+/// \sa auction_assignment
+///
+template <typename T>
+T hungarian_assignment(const matrix<T>& cost, std::vector<size_t>& assignment) {
+  static_assert(std::is_arithmetic<T>::value && std::is_signed<T>::value,
+                "'T' must be a signed arithmetic type.");
+  const size_t num_rows = cost.num_rows();
+  const size_t num_cols = cost.num_cols();
+  assert(num_rows <= num_cols);
+  const T inf = std::numeric_limits<T>::max();
+  const size_t nil = num_cols; // Column of the row being added.
+
+  std::vector<T> row_pot(num_rows), col_pot(num_cols + 1);
+  std::vector<size_t> row_of(num_cols + 1, num_rows); // num_rows if free.
+  std::vector<size_t> way(num_cols);
+  std::vector<T> min_slack(num_cols);
+  std::vector<bool> used(num_cols + 1);
+
+  for (size_t row = 0; row != num_rows; ++row) {
+    row_of[nil] = row;
+    size_t col = nil;
+    min_slack.assign(num_cols, inf);
+    used.assign(num_cols + 1, false);
+
+    // Grow a tree of tight edges until it reaches a free column.
+    do {
+      used[col] = true;
+      const size_t i = row_of[col];
+      const auto cost_row = cost[i];
+      T delta = inf;
+      size_t next_col = nil;
+      for (size_t j = 0; j != num_cols; ++j) {
+        if (used[j])
+          continue;
+        const T slack = cost_row[j] - row_pot[i] - col_pot[j];
+        if (slack < min_slack[j]) {
+          min_slack[j] = slack;
+          way[j] = col;
+        }
+        if (min_slack[j] < delta) {
+          delta = min_slack[j];
+          next_col = j;
+        }
+      }
+      for (size_t j = 0; j != num_cols; ++j) {
+        if (used[j]) {
+          row_pot[row_of[j]] += delta;
+          col_pot[j] -= delta;
+        } else
+          min_slack[j] -= delta;
+      }
+      row_pot[row] += delta; // Row of 'nil', not counted above.
+      col = next_col;
+    } while (row_of[col] != num_rows);
+
+    // Flip the augmenting path.
+    while (col != nil) {
+      const size_t prev = way[col];
+      row_of[col] = row_of[prev];
+      col = prev;
+    }
+  }
+
+  T total = 0;
+  assignment.assign(num_rows, 0);
+  for (size_t j = 0; j != num_cols; ++j) {
+    if (row_of[j] != num_rows) {
+      assignment[row_of[j]] = j;
+      total += cost[row_of[j]][j];
+    }
+  }
+  return total;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
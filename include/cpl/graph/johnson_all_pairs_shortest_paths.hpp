@@ -0,0 +1,97 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the Johnson's algorithm.
+
+#ifndef CPL_GRAPH_JOHNSON_ALL_PAIRS_SHORTEST_PATHS_HPP
+#define CPL_GRAPH_JOHNSON_ALL_PAIRS_SHORTEST_PATHS_HPP
+
+#include <cpl/graph/bellman_ford_shortest_paths.hpp>
+#include <cpl/graph/directed_graph.hpp>       // basic_directed_graph
+#include <cpl/graph/shortest_path_engine.hpp> // batch_shortest_paths
+#include <cpl/utility/matrix.hpp>             // matrix
+#include <cstddef>                            // size_t
+#include <limits>                             // numeric_limits
+#include <numeric>                            // iota
+#include <vector>                             // vector
+
+namespace cpl {
+
+/// \brief Finds the shortest-distance for each pair of vertices in a sparse
+/// directed graph with both positive and negative edge weights.
+///
+/// A vertex potential \c h is computed with the Bellman-Ford algorithm from
+/// a virtual vertex joined to every vertex by a zero-weight edge. Edge
+/// weights are then replaced by <tt>weight[e] + h(u) - h(v)</tt>, which are
+/// non-negative and preserve shortest paths, so a Dijkstra's search can be
+/// run from each vertex. Those searches are independent, and they are split
+/// among \p num_threads threads with \c batch_shortest_paths.
+///
+/// \param g The target graph.
+/// \param weight Edge-weight map.
+/// \param[out] dist Vertex-distance matrix. The shortest distance between
+/// each pair of vertices <tt>(u, v)</tt> is stored at <tt>dist[u][v]</tt>. If
+/// no path exist from \c u to \c v, <tt>dist[u][v]</tt> is set to
+/// <tt>std::numeric_limits<Distance>::max()</tt>.
+/// \param num_threads The number of threads used by the Dijkstra's searches.
+///
+/// \returns \c false if \p g has a negative cycle, in which case \p dist is
+/// left unspecified. Otherwise returns \c true.
+///
+/// \par Complexity
+/// <tt>O(V * E * log(V))</tt>, which beats the Floyd-Warshall's algorithm
+/// when <tt>E</tt> is well below <tt>V^2 / log(V)</tt>.
+///
+/// \sa floyd_warshall_all_pairs_shortest_paths
+///
+template <typename Graph, typename Distance>
+bool johnson_all_pairs_shortest_paths(const Graph& g,
+                                      const std::vector<Distance>& weight,
+                                      matrix<Distance>& dist,
+                                      const size_t num_threads = 1) {
+  using index_type = typename Graph::index_type;
+  const Distance inf = std::numeric_limits<Distance>::max();
+  const size_t num_v = g.num_vertices();
+  const size_t num_edges = g.num_edges();
+
+  // Bellman-Ford from an extra vertex gives the potential.
+  basic_directed_graph<index_type> extended(num_v + 1);
+  std::vector<Distance> extended_weight(weight.begin(),
+                                        weight.begin() + num_edges);
+  for (size_t e = 0; e != num_edges; ++e)
+    extended.add_edge(g.source(e), g.target(e));
+  for (size_t v = 0; v != num_v; ++v) {
+    extended.add_edge(num_v, v);
+    extended_weight.push_back(0);
+  }
+  std::vector<Distance> potential;
+  if (!bellman_ford_shortest_paths(extended, num_v, extended_weight,
+                                   potential))
+    return false;
+
+  std::vector<Distance> reduced_weight(num_edges);
+  for (size_t e = 0; e != num_edges; ++e) {
+    reduced_weight[e] = weight[e] + potential[g.source(e)] -
+                        potential[g.target(e)];
+    if (reduced_weight[e] < 0)
+      reduced_weight[e] = 0; // Rounding errors.
+  }
+
+  dist.assign({num_v, num_v}, inf);
+  std::vector<index_type> sources(num_v);
+  std::iota(sources.begin(), sources.end(), index_type{0});
+  // Each source writes its own row, and only the entries it reached.
+  auto fill_row = [&](const size_t u, const std::vector<Distance>& d,
+                      const std::vector<index_type>& reached) {
+    for (const index_type v : reached)
+      dist[u][v] = d[v] - potential[u] + potential[v];
+  };
+  batch_shortest_paths(g, reduced_weight, sources, num_threads, fill_row);
+  return true;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
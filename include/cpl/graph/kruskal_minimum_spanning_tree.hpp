@@ -7,9 +7,10 @@
 #define CPL_GRAPH_KRUSKAL_MINIMUM_SPANNING_TREE_HPP
 
 #include <cpl/data_structure/disjoint_set.hpp> // disjoint_set
-#include <algorithm>                           // sort, iota
-#include <cstddef>                             // size_t
+#include <algorithm>                           // sort, partition
+#include <cstddef>                             // size_t, ptrdiff_t
 #include <numeric>                             // iota
+#include <utility>                             // swap
 #include <vector>                              // vector
 
 namespace cpl {
@@ -17,6 +18,8 @@ namespace cpl {
 /// \brief Finds a minimum spanning tree (MST) in an undirected graph with
 /// weighted edges.
 ///
+/// \tparam DisjointSet The disjoint-set type used to track the trees, such as
+/// \c disjoint_set or \c concurrent_disjoint_set.
 /// \param g The target graph.
 /// \param weight The weight map of edges.
 ///
@@ -26,24 +29,29 @@ namespace cpl {
 /// \par Complexity
 /// <tt>O(E * log(E))</tt>.
 ///
-template <typename Graph, typename Weight>
-std::vector<size_t>
+/// \sa filter_kruskal_minimum_spanning_tree, boruvka_minimum_spanning_tree
+///
+template <typename DisjointSet = disjoint_set, typename Graph,
+          typename Weight>
+std::vector<typename Graph::index_type>
 kruskal_minimum_spanning_tree(const Graph& g,
                               const std::vector<Weight>& weight) {
+  using index_type = typename Graph::index_type;
   const size_t num_vertices = g.num_vertices();
   if (num_vertices == 0)
     return {};
 
-  std::vector<size_t> edges(g.num_edges());
-  std::iota(edges.begin(), edges.end(), size_t{0});
+  std::vector<index_type> edges(g.num_edges());
+  std::iota(edges.begin(), edges.end(), index_type{0});
 
-  std::sort(edges.begin(), edges.end(),
-            [&](size_t lhs, size_t rhs) { return weight[lhs] < weight[rhs]; });
+  std::sort(edges.begin(), edges.end(), [&](index_type lhs, index_type rhs) {
+    return weight[lhs] < weight[rhs];
+  });
 
-  disjoint_set dset(num_vertices);
+  DisjointSet dset(num_vertices);
 
   const size_t max_tree_edges = num_vertices - 1;
-  std::vector<size_t> tree_edges;
+  std::vector<index_type> tree_edges;
   tree_edges.reserve(max_tree_edges);
 
   for (const auto e : edges) {
@@ -57,6 +65,102 @@ kruskal_minimum_spanning_tree(const Graph& g,
   return tree_edges;
 }
 
+/// \brief Finds a minimum spanning tree (MST) in an undirected graph with
+/// weighted edges using the filter-Kruskal algorithm.
+///
+/// Instead of sorting all the edges up front, the edges are partitioned
+/// around a pivot as in quicksort. The light part is solved first, and then
+/// the edges of the heavy part which join two vertices already in the same
+/// tree are discarded before it is partitioned again. Only small ranges are
+/// sorted, so the heaviest edges of dense graphs are rarely sorted at all.
+///
+/// Ties between equal weights are broken by the edge index, so the result
+/// is the same as the one of \c boruvka_minimum_spanning_tree.
+///
+/// \tparam DisjointSet The disjoint-set type used to track the trees, such as
+/// \c disjoint_set or \c concurrent_disjoint_set.
+/// \param g The target graph.
+/// \param weight The weight map of edges.
+///
+/// \returns A <tt>std::vector</tt> containing the edge descriptors of the MST
+/// sorted by weight.
+///
+/// \par Complexity
+/// <tt>O(E * log(E))</tt> in the worst case, and
+/// <tt>O(E + V * log(V) * log(E / V))</tt> expected on random graphs.
+///
+template <typename DisjointSet = disjoint_set, typename Graph,
+          typename Weight>
+std::vector<typename Graph::index_type>
+filter_kruskal_minimum_spanning_tree(const Graph& g,
+                                     const std::vector<Weight>& weight) {
+  using index_type = typename Graph::index_type;
+  const size_t num_vertices = g.num_vertices();
+  const size_t sort_threshold = 64; // Ranges sorted directly.
+  if (num_vertices == 0)
+    return {};
+
+  std::vector<index_type> edges(g.num_edges());
+  std::iota(edges.begin(), edges.end(), index_type{0});
+  auto edge_less = [&](const index_type lhs, const index_type rhs) {
+    return weight[lhs] < weight[rhs] ||
+           (!(weight[rhs] < weight[lhs]) && lhs < rhs);
+  };
+
+  DisjointSet dset(num_vertices);
+
+  const size_t max_tree_edges = num_vertices - 1;
+  std::vector<index_type> tree_edges;
+  tree_edges.reserve(max_tree_edges);
+
+  // Ranges of 'edges' still to be processed, the lightest one on top.
+  struct edge_range {
+    size_t first, last;
+    bool needs_filter;
+  };
+  std::vector<edge_range> ranges = {{0, edges.size(), false}};
+  while (!ranges.empty() && tree_edges.size() != max_tree_edges) {
+    edge_range range = ranges.back();
+    ranges.pop_back();
+    const auto first = edges.begin() + range.first;
+    auto last = edges.begin() + range.last;
+    if (range.needs_filter) {
+      last = std::partition(first, last, [&](const index_type e) {
+        return dset.find_set(g.source(e)) != dset.find_set(g.target(e));
+      });
+    }
+
+    if (last - first <= static_cast<std::ptrdiff_t>(sort_threshold)) {
+      std::sort(first, last, edge_less);
+      for (auto it = first; it != last; ++it) {
+        if (dset.union_set(g.source(*it), g.target(*it))) {
+          tree_edges.push_back(*it);
+          if (tree_edges.size() == max_tree_edges)
+            break;
+        }
+      }
+      continue;
+    }
+
+    // Median of three. The keys are distinct, so both parts are non-empty.
+    index_type a = *first, b = *(first + (last - first) / 2), c = *(last - 1);
+    if (edge_less(b, a))
+      std::swap(a, b);
+    if (edge_less(c, b))
+      b = edge_less(c, a) ? a : c;
+    const index_type pivot = b;
+    const auto middle = std::partition(
+        first, last, [&](const index_type e) { return edge_less(e, pivot); });
+
+    const auto middle_pos = static_cast<size_t>(middle - edges.begin());
+    const auto last_pos = static_cast<size_t>(last - edges.begin());
+    ranges.push_back({middle_pos, last_pos, true});
+    ranges.push_back({range.first, middle_pos, false});
+  }
+
+  return tree_edges;
+}
+
 } // end namespace cpl
 
 #endif // Header guard
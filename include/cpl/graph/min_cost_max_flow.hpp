@@ -0,0 +1,297 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements algorithms for the minimum-cost maximum-flow problem.
+
+#ifndef CPL_GRAPH_MIN_COST_MAX_FLOW_HPP
+#define CPL_GRAPH_MIN_COST_MAX_FLOW_HPP
+
+#include <cpl/data_structure/indexed_dary_heap.hpp> // indexed_dary_heap
+#include <cpl/graph/bellman_ford_shortest_paths.hpp>
+#include <cpl/graph/dinic_max_flow.hpp>             // dinic_max_flow
+#include <cpl/graph/directed_graph.hpp>             // basic_directed_graph
+#include <algorithm>                                // max, min
+#include <cassert>                                  // assert
+#include <cstddef>                                  // size_t
+#include <iterator>                                 // begin
+#include <limits>                                   // numeric_limits
+#include <type_traits> // is_arithmetic, is_integral, is_signed, make_signed
+#include <utility>     // pair
+#include <vector>      // vector
+
+namespace cpl {
+
+namespace detail {
+
+// Stores the flow of each edge, or zero if the flow goes through its reverse
+// edge, and returns the total cost.
+template <typename Flow, typename Cost>
+Cost store_flow(const std::vector<Flow>& capacity,
+                const std::vector<Flow>& residual,
+                const std::vector<Cost>& cost, std::vector<Flow>& flow) {
+  Cost total = 0;
+  flow.assign(capacity.size(), 0);
+  for (size_t e = 0; e != capacity.size(); ++e) {
+    if (residual[e] < capacity[e]) {
+      flow[e] = capacity[e] - residual[e];
+      total += static_cast<Cost>(flow[e]) * cost[e];
+    }
+  }
+  return total;
+}
+
+} // end namespace detail
+
+/// \brief Finds a maximum flow of minimum cost using successive shortest
+/// paths.
+///
+/// Flow is repeatedly augmented along a cheapest path from \p source to
+/// \p target in the residual graph. Initial vertex potentials are computed
+/// with the Bellman-Ford algorithm, so negative costs are allowed. After that,
+/// the reduced costs <tt>cost[e] + pot(u) - pot(v)</tt> of residual edges
+/// stay non-negative and each path is found with the Dijkstra's algorithm
+/// driven by an indexed heap.
+///
+/// As in \c edmonds_karp_max_flow, each edge must have its own reverse edge.
+/// The cost of the reverse edge must be the opposite of the cost of the edge.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param target The target vertex.
+/// \param rev_edge The reverse edge map.
+/// \param capacity The capacity map.
+/// \param cost The cost per unit of flow of each edge.
+/// \param[out] flow The flow through each edge. Only one edge of each pair
+/// of reverse edges carries flow; the flow of the other one is set to 0.
+///
+/// \returns The maximum flow from \p source to \p target and its total cost.
+///
+/// \pre <tt>source != target</tt>, <tt>cost[rev_edge[e]] == -cost[e]</tt> for
+/// each edge \c e, and no cycle of edges with positive capacity has negative
+/// cost.
+///
+/// \par Complexity
+/// <tt>O(V * E + F * E * log(V))</tt>, where \c F is the number of augmenting
+/// paths, which is at most the value of the maximum flow.
+///
+/// \sa cost_scaling_min_cost_max_flow
+///
+template <typename Graph, typename Flow, typename Cost>
+std::pair<Flow, Cost> min_cost_max_flow(
+    const Graph& g, const size_t source, const size_t target,
+    const std::vector<typename Graph::index_type>& rev_edge,
+    const std::vector<Flow>& capacity, const std::vector<Cost>& cost,
+    std::vector<Flow>& flow) {
+
+  static_assert(std::is_arithmetic<Flow>::value, "'Flow' must be arithmetic.");
+  static_assert(std::is_arithmetic<Cost>::value, "'Cost' must be arithmetic.");
+  using index_type = typename Graph::index_type;
+  const auto inf = std::numeric_limits<Cost>::max();
+  const auto nil = std::numeric_limits<index_type>::max();
+  const size_t num_v = g.num_vertices();
+  const size_t num_edges = g.num_edges();
+
+  // Potentials from Bellman-Ford over the edges with positive capacity.
+  basic_directed_graph<index_type> initial(num_v);
+  std::vector<Cost> initial_cost;
+  for (size_t e = 0; e != num_edges; ++e) {
+    if (capacity[e] > 0) {
+      initial.add_edge(g.source(e), g.target(e));
+      initial_cost.push_back(cost[e]);
+    }
+  }
+  std::vector<Cost> potential;
+  const bool no_negative_cycle =
+      bellman_ford_shortest_paths(initial, source, initial_cost, potential);
+  assert(no_negative_cycle);
+  (void)no_negative_cycle;
+
+  std::vector<Flow> residual = capacity;
+  std::vector<Cost> dist(num_v, inf);
+  std::vector<index_type> pred(num_v, nil);
+  std::vector<index_type> reached;
+  indexed_dary_heap<Cost> heap(num_v);
+
+  Flow total_flow = 0;
+  while (true) {
+    for (const index_type v : reached) {
+      dist[v] = inf;
+      pred[v] = nil;
+    }
+    reached.clear();
+
+    dist[source] = 0;
+    heap.push(source, 0);
+    while (!heap.empty()) {
+      const auto u = static_cast<index_type>(heap.top());
+      heap.pop();
+      reached.push_back(u);
+      for (const auto e : g.out_edges(u)) {
+        if (!residual[e])
+          continue;
+        const index_type v = g.target(e);
+        Cost reduced = cost[e] + potential[u] - potential[v];
+        if (reduced < 0)
+          reduced = 0; // Rounding errors.
+        const Cost alt = dist[u] + reduced; // alternative
+        if (alt >= dist[v])
+          continue;
+        dist[v] = alt;
+        pred[v] = e;
+        heap.push_or_decrease(v, alt);
+      }
+    }
+    if (dist[target] == inf)
+      break;
+
+    // Residual edges never leave the reached vertices, and augmenting keeps
+    // it that way, so the potential of the other vertices is not used again.
+    for (const index_type v : reached)
+      potential[v] += dist[v];
+
+    Flow path_flow = std::numeric_limits<Flow>::max();
+    for (auto e = pred[target]; e != nil; e = pred[g.source(e)])
+      path_flow = std::min(path_flow, residual[e]);
+    for (auto e = pred[target]; e != nil; e = pred[g.source(e)]) {
+      residual[e] -= path_flow;
+      residual[rev_edge[e]] += path_flow;
+    }
+    total_flow += path_flow;
+  }
+
+  return {total_flow, detail::store_flow(capacity, residual, cost, flow)};
+}
+
+/// \brief Finds a maximum flow of minimum cost using cost scaling.
+///
+/// A maximum flow is first found with the Dinic's algorithm. Its cost is then
+/// minimized with the Goldberg-Tarjan push-relabel method: costs are
+/// multiplied by <tt>V + 1</tt> and, for decreasing values of \c eps, every
+/// residual edge with negative reduced cost is saturated and the resulting
+/// excesses are pushed through edges with negative reduced cost, lowering
+/// vertex prices when needed, until the flow is \c eps-optimal. A 1-optimal
+/// flow in the scaled costs is optimal. The running time doesn't depend on
+/// the value of the flow, which makes this variant preferable on large
+/// instances with big capacities.
+///
+/// Unlike \c min_cost_max_flow, negative cost cycles are allowed.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param target The target vertex.
+/// \param rev_edge The reverse edge map.
+/// \param capacity The capacity map.
+/// \param cost The cost per unit of flow of each edge.
+/// \param[out] flow The flow through each edge. Only one edge of each pair
+/// of reverse edges carries flow; the flow of the other one is set to 0.
+///
+/// \returns The maximum flow from \p source to \p target and its total cost.
+///
+/// \pre <tt>source != target</tt> and <tt>cost[rev_edge[e]] == -cost[e]</tt>
+/// for each edge \c e. The scaled costs must fit in \c Cost.
+///
+/// \par Complexity
+/// <tt>O(V^2 * E * log(V * C))</tt>, where \c C is the largest absolute cost.
+///
+/// \sa min_cost_max_flow
+///
+template <typename Graph, typename Flow, typename Cost>
+std::pair<Flow, Cost> cost_scaling_min_cost_max_flow(
+    const Graph& g, const size_t source, const size_t target,
+    const std::vector<typename Graph::index_type>& rev_edge,
+    const std::vector<Flow>& capacity, const std::vector<Cost>& cost,
+    std::vector<Flow>& flow) {
+
+  static_assert(std::is_integral<Flow>::value, "'Flow' must be integral.");
+  static_assert(std::is_integral<Cost>::value && std::is_signed<Cost>::value,
+                "'Cost' must be a signed integer.");
+  using index_type = typename Graph::index_type;
+  using excess_type = typename std::make_signed<Flow>::type;
+  const size_t num_v = g.num_vertices();
+  const size_t num_edges = g.num_edges();
+  const size_t scale_factor = 8; // Division of eps between phases.
+
+  std::vector<Flow> residual;
+  const Flow total_flow =
+      dinic_max_flow(g, source, target, rev_edge, capacity, residual);
+
+  const auto scale = static_cast<Cost>(num_v + 1);
+  std::vector<Cost> scaled_cost(num_edges);
+  Cost eps = 0;
+  for (size_t e = 0; e != num_edges; ++e) {
+    scaled_cost[e] = cost[e] * scale;
+    if (capacity[e] > 0)
+      eps = std::max(eps, scaled_cost[e] < 0 ? -scaled_cost[e]
+                                             : scaled_cost[e]);
+  }
+
+  std::vector<Cost> price(num_v, 0);
+  std::vector<excess_type> excess(num_v);
+  std::vector<size_t> current(num_v);
+  std::vector<index_type> active;
+
+  auto reduced_cost = [&](const index_type e) {
+    return scaled_cost[e] + price[g.source(e)] - price[g.target(e)];
+  };
+  auto push = [&](const index_type e, const Flow amount) {
+    const index_type v = g.target(e);
+    residual[e] -= amount;
+    residual[rev_edge[e]] += amount;
+    excess[g.source(e)] -= static_cast<excess_type>(amount);
+    if (excess[v] <= 0 && excess[v] + static_cast<excess_type>(amount) > 0)
+      active.push_back(v);
+    excess[v] += static_cast<excess_type>(amount);
+  };
+
+  auto refine = [&] {
+    active.clear();
+    for (size_t e = 0; e != num_edges; ++e) {
+      const auto edge = static_cast<index_type>(e);
+      if (residual[edge] > 0 && reduced_cost(edge) < 0)
+        push(edge, residual[edge]);
+    }
+    current.assign(num_v, 0);
+
+    // FIFO order. Queued vertices still have positive excess when they are
+    // popped, since only discharging decreases an excess.
+    for (size_t head = 0; head != active.size(); ++head) {
+      const index_type u = active[head];
+      const auto& edges = g.out_edges(u);
+      const size_t degree = edges.size();
+      while (excess[u] > 0) {
+        size_t& pos = current[u];
+        for (; pos != degree && excess[u] > 0; ++pos) {
+          const auto e = std::begin(edges)[pos];
+          if (residual[e] > 0 && reduced_cost(e) < 0)
+            push(e, std::min(static_cast<Flow>(excess[u]), residual[e]));
+        }
+        if (excess[u] == 0) {
+          --pos; // The last edge may still be admissible.
+          break;
+        }
+
+        // Relabel: lower the price until some residual edge is admissible.
+        Cost new_price = std::numeric_limits<Cost>::min();
+        for (const auto e : edges)
+          if (residual[e] > 0)
+            new_price =
+                std::max(new_price, price[g.target(e)] - scaled_cost[e]);
+        price[u] = new_price - eps;
+        pos = 0;
+      }
+    }
+  };
+
+  while (eps > 1) {
+    eps = std::max<Cost>(1, eps / static_cast<Cost>(scale_factor));
+    refine();
+  }
+
+  return {total_flow, detail::store_flow(capacity, residual, cost, flow)};
+}
+
+} // end namespace cpl
+
+#endif // Header guard
@@ -6,13 +6,44 @@
 #ifndef CPL_GRAPH_MIN_ST_CUT_HPP
 #define CPL_GRAPH_MIN_ST_CUT_HPP
 
-#include <cpl/graph/edmonds_karp_max_flow.hpp> // edmonds_karp_max_flow
+#include <cpl/graph/edmonds_karp_max_flow.hpp> // edmonds_karp_engine
+#include <cpl/graph/flow_network.hpp>          // flow_network
 #include <cstddef>                             // size_t
 #include <stack>                               // stack
 #include <vector>                              // vector
 
 namespace cpl {
 
+namespace detail {
+
+// Marks the vertices reachable from 'source' through non-saturated edges.
+template <typename Graph, typename ResidualMap>
+void residual_reachable(const Graph& g, const size_t source,
+                        const ResidualMap& residual,
+                        std::vector<bool>& source_side) {
+  using index_type = typename Graph::index_type;
+  source_side.assign(g.num_vertices(), false);
+  std::stack<index_type, std::vector<index_type>> stack;
+
+  source_side[source] = true;
+  stack.push(static_cast<index_type>(source));
+  while (!stack.empty()) {
+    const index_type current = stack.top();
+    stack.pop();
+    for (const auto edge : g.out_edges(current)) {
+      const index_type neighbor = g.target(edge);
+      if (source_side[neighbor])
+        continue; // Already discovered.
+      if (!residual[edge])
+        continue; // Can't navigate through saturated edges.
+      source_side[neighbor] = true;
+      stack.push(neighbor);
+    }
+  }
+}
+
+} // end namespace detail
+
 /// \brief Finds the minimum s-t cut in the given graph.
 ///
 /// A s-t cut determines a s-t cut-set. A s-t cut-set is a set of edges that
@@ -20,15 +51,18 @@ namespace cpl {
 /// target equal to 0. A minimum s-t cut is any s-t cut which minimizes the
 /// total sum of edge's weights in the cut-set.
 ///
-/// This algorithm uses the Edmonds-Karp maximum flow algorithm to determine the
-/// weight of the min s-t cut as its value is equal to the max-flow from \p
-/// source to \p target (See max-flow min-cut theorem).
+/// This algorithm uses a maximum flow algorithm (Edmonds-Karp by default) to
+/// determine the weight of the min s-t cut as its value is equal to the
+/// max-flow from \p source to \p target (See max-flow min-cut theorem).
 ///
 /// The \p source_side output parameter is used to record the reachable vertices
 /// from \p source through the residual graph (generated by the max-flow
 /// algorithm). All edges going from reachable (source side) vertices to
 /// unreachable (non source side) vertices form part of the s-t cut-set.
 ///
+/// \tparam MaxFlow Function object type which computes the max flow, such as
+/// \c edmonds_karp_engine, \c dinic_engine or \c push_relabel_engine.
+///
 /// \param g The target graph.
 /// \param source Descriptor of the source vertex.
 /// \param target Descriptor of the target vertex.
@@ -44,37 +78,34 @@ namespace cpl {
 /// \pre <tt>source != target</tt>
 ///
 /// \par Complexity
-/// Same as the underlying max-flow algorithm. In this case:
+/// Same as the underlying max-flow algorithm. By default:
 /// <tt>O(V * E^2)</tt> (See Edmonds-Karp max-flow for details).
 ///
-template <typename Graph, typename Flow>
+template <typename MaxFlow = edmonds_karp_engine, typename Graph,
+          typename Flow>
 Flow min_st_cut(const Graph& g, const size_t source, const size_t target,
-                const std::vector<size_t>& rev_edge,
+                const std::vector<typename Graph::index_type>& rev_edge,
                 const std::vector<Flow>& capacity,
                 std::vector<bool>& source_side) {
-
   std::vector<Flow> residual;
   const auto max_flow =
-      edmonds_karp_max_flow(g, source, target, rev_edge, capacity, residual);
+      MaxFlow()(g, source, target, rev_edge, capacity, residual);
 
-  source_side.assign(g.num_vertices(), false);
-  std::stack<size_t> stack;
+  detail::residual_reachable(g, source, residual, source_side);
+  return max_flow;
+}
 
-  source_side[source] = true;
-  stack.push(source);
-  while (!stack.empty()) {
-    const size_t current = stack.top();
-    stack.pop();
-    for (const auto edge : g.out_edges(current)) {
-      const size_t neighbor = g.target(edge);
-      if (source_side[neighbor])
-        continue; // Already discovered.
-      if (!residual[edge])
-        continue; // Can't navigate through saturated edges.
-      source_side[neighbor] = true;
-      stack.push(neighbor);
-    }
-  }
+/// \brief Overload of \c min_st_cut which works directly on a
+/// \c flow_network. After the call, the residual capacities of \p net hold
+/// the maximum flow found.
+///
+template <typename MaxFlow = edmonds_karp_engine, typename Flow,
+          typename Index>
+Flow min_st_cut(flow_network<Flow, Index>& net, const size_t source,
+                const size_t target, std::vector<bool>& source_side) {
+  const auto max_flow = MaxFlow()(net, source, target);
+  detail::residual_reachable(net, source, net.residual_capacity_map(),
+                             source_side);
   return max_flow;
 }
 
@@ -0,0 +1,174 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Defines the class \c offline_dynamic_connectivity.
+
+#ifndef CPL_GRAPH_OFFLINE_DYNAMIC_CONNECTIVITY_HPP
+#define CPL_GRAPH_OFFLINE_DYNAMIC_CONNECTIVITY_HPP
+
+#include <cpl/data_structure/rollback_disjoint_set.hpp>
+#include <cassert> // assert
+#include <cstddef> // size_t
+#include <limits>  // numeric_limits
+#include <map>     // map
+#include <utility> // pair, swap
+#include <vector>  // vector
+
+namespace cpl {
+
+/// \brief Answers connectivity queries on an undirected graph whose edges are
+/// added and removed over time, once all the events are known.
+///
+/// Events are logged with \c add_edge, \c remove_edge and \c query, and
+/// \c solve answers all the queries at once. Each edge is alive during an
+/// interval of queries, which is split into <tt>O(log(Q))</tt> nodes of a
+/// segment tree over the queries. A depth-first walk of the tree unites the
+/// edges of each node in a \c rollback_disjoint_set when entering it and
+/// undoes them when leaving it, so each leaf sees exactly the edges alive
+/// at its query.
+///
+/// Parallel edges are allowed. Removing an edge removes one of its copies.
+///
+class offline_dynamic_connectivity {
+  using edge_type = std::pair<size_t, size_t>;
+
+  size_t num_vertices;
+  std::vector<edge_type> queries;
+  // Alive intervals, as query positions, of each added edge.
+  std::vector<std::pair<edge_type, std::pair<size_t, size_t>>> intervals;
+  // Start of the open intervals of each edge.
+  std::map<edge_type, std::vector<size_t>> open;
+
+  static edge_type make_key(size_t u, size_t v) {
+    if (v < u)
+      std::swap(u, v);
+    return {u, v};
+  }
+
+public:
+  /// \brief Constructs an empty event log for a graph with \p n vertices and
+  /// no edges.
+  ///
+  explicit offline_dynamic_connectivity(size_t n) : num_vertices(n) {}
+
+  /// \brief Logs the insertion of the edge <tt>(u, v)</tt>.
+  ///
+  /// \par Complexity
+  /// <tt>O(log(E))</tt>.
+  ///
+  void add_edge(size_t u, size_t v) {
+    open[make_key(u, v)].push_back(queries.size());
+  }
+
+  /// \brief Logs the removal of one copy of the edge <tt>(u, v)</tt>.
+  ///
+  /// \pre The edge must be present.
+  ///
+  /// \par Complexity
+  /// <tt>O(log(E))</tt>.
+  ///
+  void remove_edge(size_t u, size_t v) {
+    const auto it = open.find(make_key(u, v));
+    assert(it != open.end());
+    const size_t start = it->second.back();
+    it->second.pop_back();
+    if (start != queries.size())
+      intervals.push_back({it->first, {start, queries.size()}});
+    if (it->second.empty())
+      open.erase(it);
+  }
+
+  /// \brief Logs a query asking whether \p u and \p v are connected.
+  ///
+  /// \returns The position of the answer in the vector returned by
+  /// \c solve.
+  ///
+  size_t query(size_t u, size_t v) {
+    queries.emplace_back(u, v);
+    return queries.size() - 1;
+  }
+
+  /// \brief Answers all the logged queries.
+  ///
+  /// \returns A vector whose i-th entry tells whether the vertices of the
+  /// i-th query were connected when it was logged.
+  ///
+  /// \par Complexity
+  /// <tt>O((Q + E * log(Q)) * log(V))</tt>, where \c Q is the number of
+  /// queries and \c E the number of added edges.
+  ///
+  std::vector<bool> solve() const {
+    const size_t num_queries = queries.size();
+    std::vector<bool> answer(num_queries);
+    if (num_queries == 0)
+      return answer;
+
+    size_t num_leaves = 1;
+    while (num_leaves < num_queries)
+      num_leaves *= 2;
+    std::vector<std::vector<edge_type>> edges_of(2 * num_leaves);
+
+    auto insert = [&](const edge_type& edge, size_t first, size_t last) {
+      for (first += num_leaves, last += num_leaves; first < last;
+           first /= 2, last /= 2) {
+        if (first & 1)
+          edges_of[first++].push_back(edge);
+        if (last & 1)
+          edges_of[--last].push_back(edge);
+      }
+    };
+    for (const auto& interval : intervals)
+      insert(interval.first, interval.second.first, interval.second.second);
+    for (const auto& entry : open)
+      for (const size_t start : entry.second)
+        if (start != num_queries)
+          insert(entry.first, start, num_queries);
+
+    // Iterative DFS. A node is pushed again with its snapshot, to be rolled
+    // back once its subtree is done.
+    const auto enter = std::numeric_limits<size_t>::max();
+    rollback_disjoint_set dset(num_vertices);
+    std::vector<std::pair<size_t, size_t>> stack = {{1, enter}};
+    while (!stack.empty()) {
+      const size_t node = stack.back().first;
+      const size_t snapshot = stack.back().second;
+      stack.pop_back();
+      if (snapshot != enter) {
+        dset.rollback(snapshot);
+        continue;
+      }
+      if ((node << depth_below(node, num_leaves)) - num_leaves >= num_queries)
+        continue; // Only padding leaves.
+
+      const size_t current = dset.snapshot();
+      for (const auto& edge : edges_of[node])
+        dset.union_set(edge.first, edge.second);
+      if (node >= num_leaves) {
+        const auto& q = queries[node - num_leaves];
+        answer[node - num_leaves] =
+            dset.find_set(q.first) == dset.find_set(q.second);
+        dset.rollback(current);
+      } else {
+        stack.emplace_back(node, current);
+        stack.emplace_back(2 * node + 1, enter);
+        stack.emplace_back(2 * node, enter);
+      }
+    }
+    return answer;
+  }
+
+private:
+  // Number of levels between 'node' and the leaves.
+  static size_t depth_below(size_t node, const size_t num_leaves) {
+    size_t depth = 0;
+    for (; node < num_leaves; node *= 2)
+      ++depth;
+    return depth;
+  }
+};
+
+} // end namespace cpl
+
+#endif // Header guard
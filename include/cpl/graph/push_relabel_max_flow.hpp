@@ -0,0 +1,282 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the highest-label push-relabel algorithm.
+
+#ifndef CPL_GRAPH_PUSH_RELABEL_MAX_FLOW_HPP
+#define CPL_GRAPH_PUSH_RELABEL_MAX_FLOW_HPP
+
+#include <cpl/graph/flow_network.hpp> // flow_network
+#include <algorithm>                  // max, min
+#include <cstddef>                    // size_t
+#include <initializer_list>           // initializer_list
+#include <iterator>                   // begin
+#include <type_traits>                // is_arithmetic
+#include <vector>                     // vector
+
+namespace cpl {
+
+namespace detail {
+
+// Scratch buffers of push_relabel_run which don't depend on the flow type,
+// so they can be kept between calls.
+template <typename Index>
+struct push_relabel_workspace {
+  std::vector<size_t> label;
+  std::vector<size_t> label_count; // Vertices with each label.
+  std::vector<size_t> current;     // Position of the current edge.
+  std::vector<std::vector<Index>> active;
+  std::vector<Index> bfs_queue;
+};
+
+// 'residual' must hold the initial capacities. See edmonds_karp_run.
+template <typename Flow, typename Graph, typename RevEdgeMap,
+          typename ResidualMap, typename Index>
+Flow push_relabel_run(const Graph& g, const size_t source, const size_t target,
+                      const RevEdgeMap& rev_edge, ResidualMap& residual,
+                      push_relabel_workspace<Index>& workspace) {
+
+  static_assert(std::is_arithmetic<Flow>::value, "'Flow' must be arithmetic.");
+  using index_type = typename Graph::index_type;
+  const size_t num_v = g.num_vertices();
+  const size_t max_label = 2 * num_v - 1;
+
+  auto& label = workspace.label;
+  auto& label_count = workspace.label_count;
+  auto& current = workspace.current;
+  auto& active = workspace.active;
+  label.assign(num_v, 0);
+  label_count.assign(max_label + 1, 0);
+  current.assign(num_v, 0);
+  active.resize(max_label + 1);
+  for (auto& bucket : active)
+    bucket.clear();
+  std::vector<Flow> excess(num_v);
+  size_t highest = 0; // No active vertex has a label above this one.
+
+  auto activate = [&](const Index v) {
+    active[label[v]].push_back(v);
+    highest = std::max(highest, label[v]);
+  };
+
+  // Sets labels to the BFS distance to the target, or to V plus the distance
+  // to the source. Vertices which reach neither have no excess.
+  auto& bfs_queue = workspace.bfs_queue;
+  auto global_relabel = [&] {
+    label.assign(num_v, max_label);
+    label[target] = 0;
+    label[source] = num_v;
+    for (const size_t root : {target, source}) {
+      bfs_queue.assign(1, static_cast<Index>(root));
+      for (size_t head = 0; head != bfs_queue.size(); ++head) {
+        const Index curr = bfs_queue[head];
+        for (const auto edge : g.out_edges(curr)) {
+          const Index child = g.target(edge);
+          if (label[child] != max_label || !residual[rev_edge[edge]])
+            continue;
+          label[child] = label[curr] + 1;
+          bfs_queue.push_back(child);
+        }
+      }
+    }
+
+    label_count.assign(max_label + 1, 0);
+    for (auto& bucket : active)
+      bucket.clear();
+    highest = 0;
+    for (size_t v = 0; v != num_v; ++v) {
+      ++label_count[label[v]];
+      current[v] = 0;
+      if (excess[v] > 0 && v != source && v != target)
+        activate(static_cast<Index>(v));
+    }
+  };
+
+  auto push = [&](const index_type edge, const Flow amount) {
+    const index_type v = g.target(edge);
+    residual[edge] -= amount;
+    residual[rev_edge[edge]] += amount;
+    excess[g.source(edge)] -= amount;
+    if (excess[v] == 0 && v != source && v != target)
+      activate(v);
+    excess[v] += amount;
+  };
+
+  // Work done since the last global relabeling.
+  const size_t relabel_period = 6 * num_v + g.num_edges();
+  size_t work = 0;
+
+  auto relabel = [&](const Index u) {
+    const size_t old_label = label[u];
+    size_t new_label = max_label;
+    for (const auto edge : g.out_edges(u))
+      if (residual[edge])
+        new_label = std::min(new_label, label[g.target(edge)] + 1);
+    work += g.out_edges(u).size() + 1;
+
+    --label_count[old_label];
+    label[u] = new_label;
+    ++label_count[new_label];
+    current[u] = 0;
+
+    if (old_label < num_v && label_count[old_label] == 0) { // Gap.
+      for (size_t v = 0; v != num_v; ++v) {
+        if (label[v] <= old_label || label[v] >= num_v)
+          continue;
+        --label_count[label[v]];
+        label[v] = num_v + 1;
+        ++label_count[label[v]];
+        current[v] = 0;
+      }
+      highest = std::max(highest, num_v + 1);
+    }
+  };
+
+  auto discharge = [&](const Index u) {
+    while (excess[u] > 0) {
+      const auto& edges = g.out_edges(u);
+      const size_t degree = edges.size();
+      size_t& pos = current[u];
+      for (; pos != degree; ++pos) {
+        const auto edge = std::begin(edges)[pos];
+        if (residual[edge] && label[u] == label[g.target(edge)] + 1) {
+          push(edge, std::min(excess[u], residual[edge]));
+          if (excess[u] == 0)
+            return; // The current edge may still be admissible.
+        }
+      }
+      relabel(u);
+    }
+  };
+
+  for (const auto edge : g.out_edges(source))
+    if (g.target(edge) != source)
+      excess[source] += residual[edge];
+  for (const auto edge : g.out_edges(source))
+    if (g.target(edge) != source && residual[edge])
+      push(edge, residual[edge]);
+  global_relabel();
+
+  while (true) {
+    while (highest != 0 && active[highest].empty())
+      --highest;
+    if (active[highest].empty())
+      break;
+    const Index u = active[highest].back();
+    active[highest].pop_back();
+    if (label[u] != highest) { // Moved by a gap relabeling.
+      activate(u);
+      continue;
+    }
+
+    discharge(u);
+    if (work > relabel_period) {
+      work = 0;
+      global_relabel();
+    }
+  }
+  return excess[target];
+}
+
+} // end namespace detail
+
+/// \brief Solves the maximum flow problem using the highest-label
+/// push-relabel algorithm.
+///
+/// The source saturates all its out-edges and the excess of each vertex is
+/// then pushed towards vertices with lower label, always discharging first the
+/// active vertex with highest label. Two heuristics keep labels close to the
+/// exact distances in the residual graph:
+/// - Global relabeling: labels are periodically recomputed with a backward
+///   BFS from \p target (and from \p source for vertices which can't reach
+///   \p target).
+/// - Gap relabeling: when no vertex is left with some label <tt>k < V</tt>,
+///   vertices with label between \c k and \c V are cut from \p target, so
+///   their labels are raised over \c V at once.
+///
+/// The excess which can't reach \p target is returned to \p source, so the
+/// result is a valid flow and not just a preflow.
+///
+/// The requirements on \p g, \p rev_edge and \p capacity are the same as in
+/// \c edmonds_karp_max_flow.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param target The target vertex.
+/// \param rev_edge The reverse edge map.
+/// \param capacity The capacity map.
+/// \param[out] residual The residual capacity map. The final flow of each
+/// edge \c e can be obtained as <tt>capacity[e] - residual[e]</tt>.
+///
+/// \returns The maximum possible flow from \p source to \p target.
+///
+/// \pre <tt>source != target</tt>
+///
+/// \par Complexity
+/// <tt>O(V^2 * sqrt(E))</tt>.
+///
+/// \sa edmonds_karp_max_flow, dinic_max_flow
+///
+template <typename Graph, typename Flow>
+Flow push_relabel_max_flow(
+    const Graph& g, const size_t source, const size_t target,
+    const std::vector<typename Graph::index_type>& rev_edge,
+    const std::vector<Flow>& capacity, std::vector<Flow>& residual) {
+  residual = capacity;
+  detail::push_relabel_workspace<typename Graph::index_type> workspace;
+  return detail::push_relabel_run<Flow>(g, source, target, rev_edge, residual,
+                                        workspace);
+}
+
+/// \brief Overload of \c push_relabel_max_flow which works directly on a
+/// \c flow_network. The residual capacities of \p net are reset before
+/// solving and hold the final residual capacities afterwards.
+///
+template <typename Flow, typename Index>
+Flow push_relabel_max_flow(flow_network<Flow, Index>& net, const size_t source,
+                           const size_t target) {
+  net.reset();
+  auto residual = net.residual_capacity_map();
+  detail::push_relabel_workspace<Index> workspace;
+  return detail::push_relabel_run<Flow>(net, source, target, net.rev_edge_map(),
+                                        residual, workspace);
+}
+
+/// \brief Function object which solves max-flow problems like
+/// \c push_relabel_max_flow. It can be used to select the max-flow algorithm
+/// of \c min_st_cut and \c gusfield_all_pairs_min_cut.
+///
+/// Like \c edmonds_karp_engine, it keeps its scratch buffers between calls
+/// and must not be shared by threads. Only the excess of each vertex, whose
+/// type depends on the flow, is allocated by each call.
+///
+class push_relabel_engine {
+  detail::push_relabel_workspace<size_t> workspace;
+
+public:
+  template <typename Graph, typename Flow>
+  Flow operator()(const Graph& g, const size_t source, const size_t target,
+                  const std::vector<typename Graph::index_type>& rev_edge,
+                  const std::vector<Flow>& capacity,
+                  std::vector<Flow>& residual) {
+    residual = capacity;
+    return detail::push_relabel_run<Flow>(g, source, target, rev_edge,
+                                          residual, workspace);
+  }
+
+  template <typename Flow, typename Index>
+  Flow operator()(flow_network<Flow, Index>& net, const size_t source,
+                  const size_t target) {
+    net.reset();
+    auto residual = net.residual_capacity_map();
+    return detail::push_relabel_run<Flow>(net, source, target,
+                                          net.rev_edge_map(), residual,
+                                          workspace);
+  }
+};
+
+} // end namespace cpl
+
+#endif // Header guard
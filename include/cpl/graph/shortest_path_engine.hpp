@@ -0,0 +1,162 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Defines the class \c shortest_path_engine.
+
+#ifndef CPL_GRAPH_SHORTEST_PATH_ENGINE_HPP
+#define CPL_GRAPH_SHORTEST_PATH_ENGINE_HPP
+
+#include <cpl/data_structure/indexed_dary_heap.hpp> // indexed_dary_heap
+#include <cpl/utility/parallel.hpp>                 // parallel_for
+#include <cstddef>                                  // size_t
+#include <functional>                               // ref
+#include <limits>                                   // numeric_limits
+#include <vector>                                   // vector
+
+namespace cpl {
+
+/// \brief Runs the Dijkstra's algorithm from many sources on the same graph.
+///
+/// The engine owns the distance map and the heap, so consecutive queries do
+/// not allocate memory. Only the entries touched by the last query are reset,
+/// which makes queries that explore a small part of the graph cheap.
+///
+/// The engine is not thread-safe, but engines built over the same graph are
+/// independent of each other, so each thread can own one.
+///
+/// \tparam Graph Directed graph type.
+/// \tparam Distance Distance type.
+/// \tparam Arity Arity of the heap. See \c indexed_dary_heap.
+///
+/// \sa dijkstra_shortest_paths, batch_shortest_paths
+///
+template <class Graph, class Distance, size_t Arity = 4>
+class shortest_path_engine {
+  using index_type = typename Graph::index_type;
+
+public:
+  /// \brief Constructs an engine for the given graph.
+  ///
+  /// \param g The target graph. It must outlive the engine.
+  /// \param weight Weight map of edges. It must outlive the engine.
+  ///
+  /// \pre All weights must be non-negative.
+  ///
+  /// \par Complexity
+  /// <tt>O(V)</tt>.
+  ///
+  shortest_path_engine(const Graph& g, const std::vector<Distance>& weight)
+      : graph(g), weight_of(weight),
+        dist(g.num_vertices(), std::numeric_limits<Distance>::max()),
+        heap(g.num_vertices()) {}
+
+  /// \brief Computes the shortest distances from \p source.
+  ///
+  /// \returns A vector \c dist such that <tt>dist[v]</tt> contains the
+  /// shortest distance from the vertex \p source to the vertex \c v, as in
+  /// \c dijkstra_shortest_paths. It is invalidated by the next query.
+  ///
+  /// \par Complexity
+  /// <tt>O(T + (R * Arity + E') * log(R) / log(Arity))</tt>, where \c T is
+  /// the number of vertices reached by the previous query, and \c R and
+  /// \c E' are the number of vertices and edges reached by this one.
+  ///
+  const std::vector<Distance>& run(const size_t source) {
+    for (const index_type v : touched)
+      dist[v] = std::numeric_limits<Distance>::max();
+    touched.clear();
+
+    dist[source] = 0;
+    touched.push_back(static_cast<index_type>(source));
+    heap.push(source, dist[source]);
+
+    while (!heap.empty()) {
+      const auto u = static_cast<index_type>(heap.top());
+      heap.pop();
+      for (const auto edge : graph.out_edges(u)) {
+        const index_type v = graph.target(edge);
+        const Distance alt = dist[u] + weight_of[edge]; // alternative
+        if (alt >= dist[v])
+          continue;
+        if (dist[v] == std::numeric_limits<Distance>::max())
+          touched.push_back(v);
+        heap.push_or_decrease(v, dist[v] = alt);
+      }
+    }
+    return dist;
+  }
+
+  /// \brief Runs a query from each source in <tt>[first, last)</tt>.
+  ///
+  /// \param first The beginning of the range of sources.
+  /// \param last The end of the range of sources.
+  /// \param fn Function invoked as <tt>fn(source, dist, reached)</tt> after
+  /// each query, where \c dist is the result of <tt>run(source)</tt> and
+  /// \c reached is <tt>reached_vertices()</tt>. Visiting only \c reached
+  /// keeps the cost of each call proportional to the explored part.
+  ///
+  template <typename InputIt, typename Function>
+  void run(InputIt first, InputIt last, Function fn) {
+    for (; first != last; ++first) {
+      const size_t source = *first;
+      fn(source, run(source), touched);
+    }
+  }
+
+  /// \brief Returns the distance to \p v computed by the last query.
+  Distance distance(const size_t v) const {
+    return dist[v];
+  }
+
+  /// \brief Returns the vertices reached by the last query, in the order they
+  /// were reached.
+  const std::vector<index_type>& reached_vertices() const {
+    return touched;
+  }
+
+private:
+  const Graph& graph;
+  const std::vector<Distance>& weight_of;
+  std::vector<Distance> dist;
+  std::vector<index_type> touched; // Vertices with a finite distance.
+  indexed_dary_heap<Distance, Arity> heap;
+};
+
+/// \brief Runs the Dijkstra's algorithm from each source of a batch, on
+/// several threads.
+///
+/// The sources are split into contiguous chunks, and each chunk is handled
+/// by its own thread through its own \c shortest_path_engine, so the
+/// workspaces are allocated once per thread and never shared.
+///
+/// \tparam Arity Arity of the heaps. See \c indexed_dary_heap.
+///
+/// \param g The target graph.
+/// \param weight Weight map of edges.
+/// \param sources The sources of the queries.
+/// \param num_threads The number of threads to use.
+/// \param fn Function invoked as <tt>fn(source, dist, reached)</tt> after
+/// each query, as in \c shortest_path_engine::run. Calls for sources of
+/// different chunks happen concurrently, so \p fn must be safe to call that
+/// way.
+///
+/// \pre All weights must be non-negative.
+///
+template <size_t Arity = 4, class Graph, class Distance, class Source,
+          class Function>
+void batch_shortest_paths(const Graph& g, const std::vector<Distance>& weight,
+                          const std::vector<Source>& sources,
+                          const size_t num_threads, Function fn) {
+  parallel_for(sources.size(), num_threads,
+               [&](size_t, const size_t first, const size_t last) {
+                 shortest_path_engine<Graph, Distance, Arity> engine(g, weight);
+                 engine.run(sources.begin() + first, sources.begin() + last,
+                            std::ref(fn));
+               });
+}
+
+} // end namespace cpl
+
+#endif // Header guard
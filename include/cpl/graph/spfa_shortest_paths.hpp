@@ -0,0 +1,184 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Implements the queue-based Bellman-Ford algorithm (SPFA).
+
+#ifndef CPL_GRAPH_SPFA_SHORTEST_PATHS_HPP
+#define CPL_GRAPH_SPFA_SHORTEST_PATHS_HPP
+
+#include <algorithm> // reverse
+#include <cstddef>   // size_t
+#include <deque>     // deque
+#include <limits>    // numeric_limits
+#include <vector>    // vector
+
+namespace cpl {
+
+namespace detail {
+
+// Looks for a cycle in the graph formed by the predecessor edges. Any such
+// cycle has negative weight. Stores its edges in path order.
+template <typename Graph, typename Index>
+bool find_pred_cycle(const Graph& g, const std::vector<Index>& pred,
+                     std::vector<Index>& cycle) {
+  const auto nil = std::numeric_limits<Index>::max();
+  const size_t num_v = pred.size();
+  std::vector<size_t> walk_id(num_v, 0); // 0 if the vertex was not visited.
+
+  for (size_t root = 0; root != num_v; ++root) {
+    size_t v = root;
+    while (walk_id[v] == 0) {
+      walk_id[v] = root + 1;
+      if (pred[v] == nil)
+        break;
+      v = g.source(pred[v]);
+    }
+    if (walk_id[v] != root + 1 || pred[v] == nil)
+      continue; // Reached a vertex explored by a previous walk, or a root.
+
+    size_t u = v;
+    do {
+      cycle.push_back(pred[u]);
+      u = g.source(pred[u]);
+    } while (u != v);
+    std::reverse(cycle.begin(), cycle.end());
+    return true;
+  }
+  return false;
+}
+
+} // end namespace detail
+
+/// \brief Heuristics which reorder the worklist of \c spfa_shortest_paths.
+///
+/// They do not change the result, but usually reduce the number of times
+/// each vertex is scanned.
+///
+enum class spfa_heuristic {
+  none,              ///< Plain FIFO queue.
+  small_label_first, ///< Vertices with lower distance than the front of the
+                     ///< queue are pushed to the front.
+  large_label_last,  ///< Vertices with higher distance than the average of
+                     ///< the queue are moved to the back before scanning.
+  both               ///< Both \c small_label_first and \c large_label_last.
+};
+
+/// \brief Solves the single-source shortest paths problem for a digraph with
+/// both positive and negative edge weights.
+///
+/// This is the Bellman-Ford algorithm driven by a worklist: only the
+/// out-edges of vertices whose distance changed are relaxed again, so the
+/// running time is usually close to linear on sparse graphs.
+///
+/// \param g The target graph.
+/// \param source The source vertex.
+/// \param weight Weight map of edges.
+/// \param[out] dist The distance from \p source to each vertex.
+/// Distances for unreachable vertices are set to
+/// <tt>std::numeric_limits<Distance>::max()</tt>.
+/// \param[out] pred The edge used to reach each vertex in the shortest path
+/// tree, or <tt>std::numeric_limits<index_type>::max()</tt> for \p source and
+/// unreachable vertices.
+/// \param[out] cycle If a negative cycle reachable from \p source is found,
+/// its edges are stored here in path order. Otherwise it is left empty.
+/// \param heuristic The queue discipline. See \c spfa_heuristic.
+///
+/// \returns \c true if all distances were minimized i.e if \p g had no
+/// negative cycle reachable from \p source. Otherwise returns \c false, and
+/// \p dist and \p pred are unspecified.
+///
+/// \par Complexity
+/// <tt>O(V * E)</tt> in the worst case.
+///
+/// \sa bellman_ford_shortest_paths
+///
+template <typename Graph, typename Distance>
+bool spfa_shortest_paths(
+    const Graph& g, const size_t source, const std::vector<Distance>& weight,
+    std::vector<Distance>& dist, std::vector<typename Graph::index_type>& pred,
+    std::vector<typename Graph::index_type>& cycle,
+    const spfa_heuristic heuristic = spfa_heuristic::none) {
+  using index_type = typename Graph::index_type;
+  const auto infinity = std::numeric_limits<Distance>::max();
+  const auto nil = std::numeric_limits<index_type>::max();
+  const size_t num_v = g.num_vertices();
+  const bool slf = heuristic == spfa_heuristic::small_label_first ||
+                   heuristic == spfa_heuristic::both;
+  const bool lll = heuristic == spfa_heuristic::large_label_last ||
+                   heuristic == spfa_heuristic::both;
+
+  dist.assign(num_v, infinity);
+  pred.assign(num_v, nil);
+  cycle.clear();
+
+  std::vector<bool> queued(num_v, false);
+  std::deque<index_type> queue;
+  // Only maintained for 'large_label_last'. Kept in a floating type so that
+  // neither the sum nor the comparison below can overflow.
+  long double queued_sum = 0;
+  size_t num_relaxed = 0;
+
+  dist[source] = 0;
+  queue.push_back(static_cast<index_type>(source));
+  queued[source] = true;
+
+  while (!queue.empty()) {
+    if (lll) {
+      // Some vertex is not above the average, but rounding errors could hide
+      // it, so at most one lap is made.
+      const auto count = static_cast<long double>(queue.size());
+      for (size_t i = 0; i != queue.size(); ++i) {
+        if (static_cast<long double>(dist[queue.front()]) * count <= queued_sum)
+          break;
+        queue.push_back(queue.front());
+        queue.pop_front();
+      }
+    }
+    const index_type u = queue.front();
+    queue.pop_front();
+    queued[u] = false;
+    if (lll)
+      queued_sum -= dist[u];
+
+    for (const auto e : g.out_edges(u)) {
+      const index_type v = g.target(e);
+      const Distance alt = dist[u] + weight[e]; // alternative
+      if (alt >= dist[v])
+        continue;
+
+      if (queued[v] && lll)
+        queued_sum -= dist[v];
+      dist[v] = alt;
+      pred[v] = e;
+
+      // With a negative cycle the queue never empties, but the predecessor
+      // graph eventually contains it. Checking it every V relaxations costs
+      // amortized constant time per relaxation.
+      if (++num_relaxed == num_v) {
+        num_relaxed = 0;
+        if (detail::find_pred_cycle(g, pred, cycle))
+          return false;
+      }
+
+      if (queued[v]) {
+        if (lll)
+          queued_sum += alt;
+        continue;
+      }
+      queued[v] = true;
+      if (lll)
+        queued_sum += alt;
+      if (slf && !queue.empty() && alt < dist[queue.front()])
+        queue.push_front(v);
+      else
+        queue.push_back(v);
+    }
+  }
+  return true;
+}
+
+} // end namespace cpl
+
+#endif // Header guard
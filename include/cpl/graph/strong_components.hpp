@@ -6,15 +6,97 @@
 #ifndef CPL_GRAPH_STRONG_COMPONENTS_HPP
 #define CPL_GRAPH_STRONG_COMPONENTS_HPP
 
-#include <algorithm>  // min
-#include <cstddef>    // size_t
-#include <cstdint>    // SIZE_MAX
-#include <functional> // function
-#include <stack>      // stack
-#include <vector>     // vector
+#include <cpl/graph/depth_first_search.hpp> // depth_first_search
+#include <cpl/utility/parallel.hpp>          // parallel_for
+#include <algorithm>                         // min, sort
+#include <atomic>                            // atomic
+#include <cstddef>                           // size_t
+#include <limits>                            // numeric_limits
+#include <numeric>                           // iota
+#include <random>                            // minstd_rand
+#include <utility>                           // move
+#include <vector>                            // vector
 
 namespace cpl {
 
+namespace detail {
+
+template <typename Graph, typename Label>
+class tarjan_scc_visitor : public dfs_visitor {
+  using index_type = typename Graph::index_type;
+
+public:
+  tarjan_scc_visitor(const size_t num_vertices, std::vector<Label>& comp_)
+      : low(num_vertices), dtm(num_vertices), comp(comp_) {
+    comp.resize(num_vertices);
+  }
+
+  void discover_vertex(const index_type v) {
+    low[v] = dtm[v] = ++time;
+    comp[v] = in_stack;
+    stack.push_back(v);
+  }
+  void back_edge(index_type, const index_type u, const index_type v) {
+    low[u] = std::min(low[u], dtm[v]);
+  }
+  void forward_or_cross_edge(index_type, const index_type u,
+                             const index_type v) {
+    if (comp[v] == in_stack)
+      low[u] = std::min(low[u], dtm[v]);
+  }
+  void finish_edge(index_type, const index_type u, const index_type v) {
+    low[u] = std::min(low[u], low[v]);
+  }
+  void finish_vertex(const index_type v) {
+    if (dtm[v] != low[v])
+      return;
+    while (true) {
+      const index_type w = stack.back();
+      stack.pop_back();
+      comp[w] = static_cast<Label>(comp_cnt);
+      if (w == v)
+        break;
+    }
+    ++comp_cnt;
+  }
+
+  size_t num_components() const {
+    return comp_cnt;
+  }
+
+private:
+  const Label in_stack = std::numeric_limits<Label>::max();
+  index_type time = 0;
+  size_t comp_cnt = 0;
+  std::vector<index_type> stack;
+  std::vector<index_type> low;
+  std::vector<index_type> dtm;
+  std::vector<Label>& comp;
+};
+
+// Calls 'visit(u, next)' for each vertex 'u' of 'level' on up to
+// 'num_threads' threads, each one with its own 'next' list, and then replaces
+// 'level' by those lists. If 'sorted' is set, the new level is sorted so that
+// its order does not depend on the number of threads.
+template <typename Index, typename Visit>
+void fb_next_level(std::vector<Index>& level, const size_t num_threads,
+                   const bool sorted, Visit visit) {
+  std::vector<std::vector<Index>> next(
+      parallel_num_chunks(level.size(), num_threads));
+  parallel_for(level.size(), num_threads,
+               [&](const size_t chunk, const size_t first, const size_t last) {
+                 for (size_t i = first; i != last; ++i)
+                   visit(level[i], next[chunk]);
+               });
+  level.clear();
+  for (const auto& part : next)
+    level.insert(level.end(), part.begin(), part.end());
+  if (sorted)
+    std::sort(level.begin(), level.end());
+}
+
+} // end namespace detail
+
 /// \brief Finds the strongly connected components (SCC) of a directed graph.
 ///
 /// Uses the Tarjan's algorithm based to find the SCC of the input graph. The
@@ -34,46 +116,256 @@ namespace cpl {
 /// will form a valid topological sorting of the condensation of \p g (where \c
 /// C = the total number of SCC).
 ///
-template <typename Graph>
-size_t strong_components(const Graph& g, std::vector<size_t>& comp) {
+/// \sa forward_backward_strong_components
+///
+template <typename Graph, typename Label>
+size_t strong_components(const Graph& g, std::vector<Label>& comp) {
+  detail::tarjan_scc_visitor<Graph, Label> vis(g.num_vertices(), comp);
+  depth_first_search(g, vis);
+  return vis.num_components();
+}
 
+/// \brief Finds the strongly connected components (SCC) of a directed graph
+/// using trimming and forward-backward reachability.
+///
+/// The vertices are split into independent subproblems. In each one,
+/// vertices without incoming or outgoing edges inside the subproblem are
+/// trimmed away repeatedly as trivial components. Then the vertices reached
+/// forward and backward from a pivot are found with two searches. Their
+/// intersection is the component of the pivot, and the forward-only,
+/// backward-only and unreached vertices form three new subproblems with no
+/// component crossing between them. No step recurses.
+///
+/// The subproblems are processed in rounds, each one handling all those
+/// created by the previous round. Small subproblems are spread among the
+/// threads, and big ones are processed one at a time with every trimming
+/// step and search level split among the threads. The components are only
+/// labeled at the end, following the tree of subproblems, so the labels do
+/// not depend on \p num_threads.
+///
+/// The component map has the same meaning as in \c strong_components, and
+/// the sequence <tt>[C - 1, C - 2, ..., 2, 1, 0]</tt> is also a topological
+/// sorting of the condensation of \p g, although the labels may differ.
+///
+/// \param g The target graph. It must provide \c in_edges.
+/// \param[out] comp The component map.
+/// \param num_threads The number of threads to use.
+///
+/// \returns The total number of strongly connected components.
+///
+/// \par Complexity
+/// <tt>O((V + E) * D + V * log(V))</tt>, where \c D is the depth of the
+/// subproblem splitting. Pivots are chosen at random, which makes \c D
+/// logarithmic in expectation on chains of components, but it is
+/// <tt>O(V)</tt> in the worst case.
+///
+template <typename Graph, typename Label>
+size_t forward_backward_strong_components(const Graph& g,
+                                          std::vector<Label>& comp,
+                                          const size_t num_threads = 1) {
+  using index_type = typename Graph::index_type;
   const size_t num_vertices = g.num_vertices();
-  size_t time = 0;
-  size_t comp_cnt = 0;
-  std::stack<size_t> stack;
-  std::vector<size_t> low(num_vertices);
-  std::vector<size_t> dtm(num_vertices);
+  const auto none = std::numeric_limits<size_t>::max(); // Trimmed.
+  const auto relaxed = std::memory_order_relaxed;
+  const size_t min_parallel_size = 1 << 14; // Smaller ones do not pay off.
   comp.resize(num_vertices);
 
-  std::function<void(size_t)> dfs_visit;
-  dfs_visit = [&](const size_t v) {
-    low[v] = dtm[v] = ++time;
-    comp[v] = SIZE_MAX;
-    stack.push(v);
-    for (const auto edge : g.out_edges(v)) {
-      const size_t w = g.target(edge);
-      if (!dtm[w]) {
-        dfs_visit(w);
-        low[v] = std::min(low[v], low[w]);
-      } else if (comp[w] == SIZE_MAX)
-        low[v] = std::min(low[v], dtm[w]);
+  // Subproblems form a tree. A 'split' one is trimmed and split into its
+  // children, listed in label order. The vertices of a 'component' get a
+  // single label; 'singletons' get a label each, in order.
+  enum class task_kind { split, component, singletons };
+  struct task {
+    task_kind kind;
+    std::vector<index_type> vertices;
+    std::minstd_rand::result_type seed; // Picks the pivots of a 'split'.
+    std::vector<size_t> children;
+  };
+  std::vector<task> tasks;
+  tasks.push_back({task_kind::split, std::vector<index_type>(num_vertices),
+                   std::minstd_rand::default_seed, {}});
+  std::iota(tasks[0].vertices.begin(), tasks[0].vertices.end(), index_type{0});
+
+  // Subproblems of the same round only write the entries of their own
+  // vertices, but read those of any neighbor.
+  std::vector<std::atomic<size_t>> owner(num_vertices); // Subproblem.
+  std::vector<std::atomic<index_type>> in_degree(num_vertices);
+  std::vector<std::atomic<index_type>> out_degree(num_vertices);
+  std::vector<std::atomic<bool>> queued(num_vertices);
+  std::vector<std::atomic<bool>> forward(num_vertices);
+  std::vector<std::atomic<bool>> backward(num_vertices);
+
+  // Processes the subproblem 'id' with up to 'threads' threads, and stores
+  // its children in 'children'.
+  auto process = [&](const size_t id, const size_t threads,
+                     std::vector<task>& children) {
+    const std::vector<index_type>& vertices = tasks[id].vertices;
+    auto threads_for = [&](const size_t n) {
+      return n < min_parallel_size ? size_t{1} : threads;
+    };
+    auto add_child = [&](const task_kind kind, std::vector<index_type>&& vs,
+                         const std::minstd_rand::result_type seed) {
+      if (!vs.empty())
+        children.push_back({kind, std::move(vs), seed, {}});
+    };
+
+    parallel_for(vertices.size(), threads_for(vertices.size()),
+                 [&](size_t, const size_t first, const size_t last) {
+                   for (size_t i = first; i != last; ++i) {
+                     owner[vertices[i]].store(id, relaxed);
+                     in_degree[vertices[i]].store(0, relaxed);
+                     out_degree[vertices[i]].store(0, relaxed);
+                   }
+                 });
+    parallel_for(vertices.size(), threads_for(vertices.size()),
+                 [&](size_t, const size_t first, const size_t last) {
+                   for (size_t i = first; i != last; ++i) {
+                     const index_type v = vertices[i];
+                     for (const auto e : g.out_edges(v)) {
+                       const index_type w = g.target(e);
+                       if (w != v && owner[w].load(relaxed) == id) {
+                         out_degree[v].fetch_add(1, relaxed);
+                         in_degree[w].fetch_add(1, relaxed);
+                       }
+                     }
+                   }
+                 });
+
+    // Trimming, one level at a time. A vertex is a sink if it has no
+    // outgoing edges when its level starts. Sinks are labeled first, since
+    // the rest of the subproblem can only reach them. Sources are labeled
+    // last, in reverse order of removal.
+    std::vector<index_type> level, sinks, sources;
+    for (const index_type v : vertices) {
+      if (in_degree[v].load(relaxed) == 0 || out_degree[v].load(relaxed) == 0) {
+        queued[v].store(true, relaxed);
+        level.push_back(v);
+      }
     }
-    if (dtm[v] != low[v])
-      return;
-    while (true) {
-      const size_t w = stack.top();
-      stack.pop();
-      comp[w] = comp_cnt;
-      if (w == v)
-        break;
+    auto trim = [&](const index_type v, std::vector<index_type>& next) {
+      for (const auto e : g.out_edges(v)) {
+        const index_type w = g.target(e);
+        if (owner[w].load(relaxed) == id &&
+            in_degree[w].fetch_sub(1, relaxed) == 1 &&
+            !queued[w].exchange(true, relaxed))
+          next.push_back(w);
+      }
+      for (const auto e : g.in_edges(v)) {
+        const index_type u = g.source(e);
+        if (owner[u].load(relaxed) == id &&
+            out_degree[u].fetch_sub(1, relaxed) == 1 &&
+            !queued[u].exchange(true, relaxed))
+          next.push_back(u);
+      }
+    };
+    while (!level.empty()) {
+      for (const index_type v : level) {
+        (out_degree[v].load(relaxed) == 0 ? sinks : sources).push_back(v);
+        owner[v].store(none, relaxed);
+        queued[v].store(false, relaxed);
+      }
+      detail::fb_next_level(level, threads_for(level.size()), true, trim);
     }
-    ++comp_cnt;
+    add_child(task_kind::singletons, std::move(sinks), 0);
+
+    std::vector<index_type> remaining;
+    for (const index_type v : vertices)
+      if (owner[v].load(relaxed) == id)
+        remaining.push_back(v);
+    if (!remaining.empty()) {
+      // Forward and backward reachability from the pivot. A random pivot
+      // splits long chains of components in halves on average.
+      std::minstd_rand gen(tasks[id].seed);
+      const index_type pivot = remaining[std::uniform_int_distribution<size_t>(
+          0, remaining.size() - 1)(gen)];
+      for (int dir = 0; dir != 2; ++dir) {
+        const bool is_forward = dir == 0;
+        auto& seen = is_forward ? forward : backward;
+        auto visit = [&](const index_type u, std::vector<index_type>& next) {
+          const auto& edges = is_forward ? g.out_edges(u) : g.in_edges(u);
+          for (const auto e : edges) {
+            const index_type w = is_forward ? g.target(e) : g.source(e);
+            if (owner[w].load(relaxed) == id && !seen[w].load(relaxed) &&
+                !seen[w].exchange(true, relaxed))
+              next.push_back(w);
+          }
+        };
+        seen[pivot].store(true, relaxed);
+        level.assign(1, pivot);
+        while (!level.empty())
+          detail::fb_next_level(level, threads_for(level.size()), false,
+                                visit);
+      }
+
+      std::vector<index_type> part[4]; // Indexed by forward + 2 * backward.
+      for (const index_type v : remaining) {
+        part[(forward[v].load(relaxed) ? 1 : 0) +
+             (backward[v].load(relaxed) ? 2 : 0)]
+            .push_back(v);
+        forward[v].store(false, relaxed);
+        backward[v].store(false, relaxed);
+      }
+      // Forward-only vertices are reached from the component, which is
+      // reached from the backward-only ones. Unreached ones can only reach
+      // forward-only ones and be reached from backward-only ones.
+      const auto seed0 = gen(), seed1 = gen(), seed2 = gen();
+      add_child(task_kind::split, std::move(part[1]), seed1);
+      add_child(task_kind::split, std::move(part[0]), seed0);
+      add_child(task_kind::component, std::move(part[3]), 0);
+      add_child(task_kind::split, std::move(part[2]), seed2);
+    }
+    add_child(task_kind::singletons,
+              std::vector<index_type>(sources.rbegin(), sources.rend()), 0);
   };
 
-  for (size_t v = 0; v != num_vertices; ++v)
-    if (!dtm[v])
-      dfs_visit(v);
-  return comp_cnt;
+  std::vector<size_t> pending(1, 0), next_pending, small;
+  std::vector<std::vector<task>> produced;
+  while (!pending.empty()) {
+    produced.assign(pending.size(), std::vector<task>());
+    small.clear();
+    for (size_t i = 0; i != pending.size(); ++i) {
+      if (tasks[pending[i]].vertices.size() < min_parallel_size)
+        small.push_back(i);
+      else
+        process(pending[i], num_threads, produced[i]);
+    }
+    std::atomic<size_t> next_small(0);
+    parallel_for(small.size(), num_threads, [&](size_t, size_t, size_t) {
+      for (size_t k; (k = next_small.fetch_add(1, relaxed)) < small.size();)
+        process(pending[small[k]], 1, produced[small[k]]);
+    });
+
+    next_pending.clear();
+    for (size_t i = 0; i != pending.size(); ++i) {
+      std::vector<index_type>().swap(tasks[pending[i]].vertices);
+      for (auto& child : produced[i]) {
+        tasks[pending[i]].children.push_back(tasks.size());
+        if (child.kind == task_kind::split)
+          next_pending.push_back(tasks.size());
+        tasks.push_back(std::move(child));
+      }
+    }
+    pending.swap(next_pending);
+  }
+
+  // Labels the components in depth-first order of the tree.
+  size_t num_components = 0;
+  std::vector<size_t> stack(1, 0);
+  while (!stack.empty()) {
+    const task& current = tasks[stack.back()];
+    stack.pop_back();
+    if (current.kind == task_kind::split) {
+      stack.insert(stack.end(), current.children.rbegin(),
+                   current.children.rend());
+    } else if (current.kind == task_kind::component) {
+      for (const index_type v : current.vertices)
+        comp[v] = static_cast<Label>(num_components);
+      ++num_components;
+    } else {
+      for (const index_type v : current.vertices)
+        comp[v] = static_cast<Label>(num_components++);
+    }
+  }
+  return num_components;
 }
 
 } // end namespace cpl
@@ -6,14 +6,38 @@
 #ifndef CPL_GRAPH_TOPOLOGICAL_SORT_HPP
 #define CPL_GRAPH_TOPOLOGICAL_SORT_HPP
 
-#include <cstddef>    // size_t
-#include <functional> // function
-#include <queue>      // priority_queue
-#include <stdexcept>  // logic_error
-#include <vector>     // vector
+#include <cpl/graph/depth_first_search.hpp> // depth_first_search
+#include <cstddef>                           // size_t
+#include <queue>                             // priority_queue
+#include <stdexcept>                         // logic_error
+#include <vector>                            // vector
 
 namespace cpl {
 
+namespace detail {
+
+template <typename Graph>
+class topological_sort_visitor : public dfs_visitor {
+  using index_type = typename Graph::index_type;
+
+public:
+  explicit topological_sort_visitor(std::vector<index_type>& list_)
+      : list(list_), cur_pos{list_.size()} {}
+
+  void back_edge(index_type, index_type, index_type) {
+    throw std::logic_error("Not a DAG");
+  }
+  void finish_vertex(const index_type v) {
+    list[--cur_pos] = v;
+  }
+
+private:
+  std::vector<index_type>& list;
+  size_t cur_pos;
+};
+
+} // end namespace detail
+
 /// \brief Sorts the vertices of the given graph topologically.
 ///
 /// Uses a DFS-based approach to find a topological sort of the given graph. If
@@ -32,31 +56,10 @@ namespace cpl {
 /// \sa prioritized_topological_sort
 ///
 template <typename Graph>
-std::vector<size_t> topological_sort(const Graph& g) {
-  enum class colors { white, gray, black };
-  const size_t num_v = g.num_vertices();
-  std::vector<size_t> list(num_v);
-  std::vector<colors> color(num_v, colors::white);
-  size_t cur_pos = num_v;
-
-  std::function<void(size_t)> dfs_visit;
-  dfs_visit = [&](const size_t src) {
-    color[src] = colors::gray;
-    for (const auto e : g.out_edges(src)) {
-      const size_t tgt = g.target(e);
-      if (color[tgt] == colors::white)
-        dfs_visit(tgt);
-      else if (color[tgt] == colors::gray)
-        throw std::logic_error("Not a DAG");
-    }
-    color[src] = colors::black;
-    list[--cur_pos] = src;
-  };
-
-  for (size_t v = 0; v != num_v; ++v)
-    if (color[v] == colors::white)
-      dfs_visit(v);
-
+std::vector<typename Graph::index_type> topological_sort(const Graph& g) {
+  std::vector<typename Graph::index_type> list(g.num_vertices());
+  detail::topological_sort_visitor<Graph> vis(list);
+  depth_first_search(g, vis);
   return list;
 }
 
@@ -88,20 +91,21 @@ std::vector<size_t> topological_sort(const Graph& g) {
 template <typename Graph, typename Comp, typename UnaryFunction>
 void prioritized_topological_sort(const Graph& g, Comp comp,
                                   UnaryFunction output_vertex) {
+  using index_type = typename Graph::index_type;
   const size_t num_vertices = g.num_vertices();
   const size_t num_edges = g.num_edges();
-  std::priority_queue<size_t, std::vector<size_t>, Comp> queue(comp);
-  std::vector<size_t> in_degree(num_vertices);
+  std::priority_queue<index_type, std::vector<index_type>, Comp> queue(comp);
+  std::vector<index_type> in_degree(num_vertices);
 
   for (size_t e = 0; e != num_edges; ++e)
     ++in_degree[g.target(e)];
 
   for (size_t v = 0; v != num_vertices; ++v)
     if (!in_degree[v])
-      queue.push(v);
+      queue.push(static_cast<index_type>(v));
 
   while (!queue.empty()) {
-    const size_t src = queue.top();
+    const index_type src = queue.top();
     queue.pop();
     output_vertex(src);
 
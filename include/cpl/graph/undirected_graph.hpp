@@ -6,24 +6,39 @@
 #ifndef CPL_GRAPH_UNDIRECTED_GRAPH_HPP
 #define CPL_GRAPH_UNDIRECTED_GRAPH_HPP
 
-#include <cstddef> // size_t
-#include <utility> // pair
-#include <vector>  // vector
+#include <cstddef>     // size_t
+#include <type_traits> // is_integral, is_unsigned
+#include <utility>     // pair
+#include <vector>      // vector
 
 namespace cpl {
 
 /// \brief Adjacency list which represents undirected graphs.
 ///
-class undirected_graph {
-  std::vector<std::vector<size_t>> adj_edges;
-  std::vector<std::pair<size_t, size_t>> edge_list;
+/// \tparam Index Unsigned integer type used to store vertex and edge
+/// descriptors.
+///
+template <typename Index = size_t>
+class basic_undirected_graph {
+  static_assert(std::is_integral<Index>::value &&
+                    std::is_unsigned<Index>::value,
+                "'Index' must be an unsigned integer type.");
+
+public:
+  using index_type = Index;
+
+private:
+  std::vector<std::vector<index_type>> adj_edges;
+  std::vector<std::pair<index_type, index_type>> edge_list;
 
 public:
-  explicit undirected_graph(size_t num_vertices) : adj_edges(num_vertices) {}
+  explicit basic_undirected_graph(size_t num_vertices)
+      : adj_edges(num_vertices) {}
 
-  size_t add_edge(size_t u, size_t v) {
-    edge_list.emplace_back(u, v);
-    const size_t edge_id = edge_list.size() - 1;
+  index_type add_edge(size_t u, size_t v) {
+    edge_list.emplace_back(static_cast<index_type>(u),
+                           static_cast<index_type>(v));
+    const auto edge_id = static_cast<index_type>(edge_list.size() - 1);
     adj_edges[u].push_back(edge_id);
     adj_edges[v].push_back(edge_id);
     return edge_id;
@@ -36,17 +51,17 @@ public:
     return edge_list.size();
   }
 
-  size_t source(size_t e) const {
+  index_type source(size_t e) const {
     return edge_list[e].first;
   }
-  size_t target(size_t e) const {
+  index_type target(size_t e) const {
     return edge_list[e].second;
   }
 
-  const std::vector<size_t>& out_edges(size_t v) const {
+  const std::vector<index_type>& out_edges(size_t v) const {
     return adj_edges[v];
   }
-  const std::vector<size_t>& in_edges(size_t v) const {
+  const std::vector<index_type>& in_edges(size_t v) const {
     return adj_edges[v];
   }
 
@@ -61,6 +76,10 @@ public:
   }
 };
 
+/// \brief Undirected graph using \c size_t descriptors.
+///
+using undirected_graph = basic_undirected_graph<>;
+
 } // end namespace cpl
 
 #endif // Header guard
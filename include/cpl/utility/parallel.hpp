@@ -0,0 +1,60 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+/// \file
+/// \brief Defines helpers to split work among threads.
+
+#ifndef CPL_UTILITY_PARALLEL_HPP
+#define CPL_UTILITY_PARALLEL_HPP
+
+#include <algorithm>  // min
+#include <cstddef>    // size_t
+#include <functional> // ref
+#include <thread>     // thread
+#include <vector>     // vector
+
+namespace cpl {
+
+/// \brief Returns the number of chunks used by \c parallel_for to split
+/// \p n items among \p num_threads threads.
+///
+/// It is never greater than \p n, and it is at least one when \p n is not
+/// zero, so callers can allocate one workspace per chunk.
+///
+inline size_t parallel_num_chunks(const size_t n, const size_t num_threads) {
+  return std::min(n, num_threads == 0 ? size_t{1} : num_threads);
+}
+
+/// \brief Splits the range <tt>[0, n)</tt> into contiguous chunks of almost
+/// equal size and processes each one on its own thread.
+///
+/// The first chunk is processed by the calling thread, and the call returns
+/// once every chunk is done. The function must not throw.
+///
+/// \param n The number of items.
+/// \param num_threads The maximum number of threads to use. Zero is taken as
+/// one.
+/// \param fn Function invoked as <tt>fn(chunk, first, last)</tt> for each
+/// chunk <tt>[first, last)</tt>, where \c chunk is the position of the chunk
+/// in the range <tt>[0, parallel_num_chunks(n, num_threads))</tt>.
+///
+template <typename Function>
+void parallel_for(const size_t n, const size_t num_threads, Function fn) {
+  const size_t num_chunks = parallel_num_chunks(n, num_threads);
+  auto bound = [&](const size_t chunk) {
+    return n / num_chunks * chunk + std::min(chunk, n % num_chunks);
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(num_chunks);
+  for (size_t chunk = 1; chunk < num_chunks; ++chunk)
+    workers.emplace_back(std::ref(fn), chunk, bound(chunk), bound(chunk + 1));
+  if (num_chunks != 0)
+    fn(size_t{0}, bound(0), bound(1));
+  for (auto& worker : workers)
+    worker.join();
+}
+
+} // end namespace cpl
+
+#endif // Header guard
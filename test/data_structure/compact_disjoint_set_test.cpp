@@ -0,0 +1,89 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/data_structure/compact_disjoint_set.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/data_structure/disjoint_set.hpp> // disjoint_set
+#include <cstddef>                             // size_t
+#include <cstdint>                             // uint32_t
+#include <random>                              // mt19937
+#include <utility>                             // pair
+#include <vector>                              // vector
+
+using cpl::compact_disjoint_set;
+using cpl::disjoint_set;
+using std::size_t;
+
+TEST(compact_disjoint_set, WorksWell) {
+  compact_disjoint_set d(8);
+  EXPECT_EQ(8, d.num_sets());
+
+  EXPECT_TRUE(d.union_set(2, 3));
+  EXPECT_TRUE(d.union_set(0, 4));
+  EXPECT_TRUE(d.union_set(1, 7));
+  EXPECT_TRUE(d.union_set(5, 4));
+  EXPECT_TRUE(d.union_set(1, 0));
+  EXPECT_FALSE(d.union_set(7, 5));
+
+  EXPECT_EQ(d.find_set(1), d.find_set(4));
+  EXPECT_EQ(d.find_set(4), d.find_set(5));
+  EXPECT_EQ(d.find_set(5), d.find_set(7));
+  EXPECT_NE(d.find_set(7), d.find_set(2));
+  EXPECT_EQ(d.find_set(2), d.find_set(3));
+  EXPECT_NE(d.find_set(3), d.find_set(6));
+  EXPECT_NE(d.find_set(6), d.find_set(0));
+
+  EXPECT_EQ(3, d.num_sets());
+  EXPECT_EQ(5, d.set_size(7));
+  EXPECT_EQ(2, d.set_size(2));
+  EXPECT_EQ(1, d.set_size(6));
+  EXPECT_EQ(8, d.size());
+}
+
+TEST(compact_disjoint_set, WorksOnLargeSets) {
+  // A single set built one element at a time.
+  const size_t n = 1000000;
+  compact_disjoint_set d(n);
+  disjoint_set reference(n);
+  for (size_t x = 1; x != n; ++x) {
+    d.union_set(static_cast<std::uint32_t>(x),
+                static_cast<std::uint32_t>(x - 1));
+    reference.union_set(x, x - 1);
+  }
+  EXPECT_EQ(1, d.num_sets());
+  EXPECT_EQ(n, d.set_size(0));
+  EXPECT_EQ(d.find_set(0), d.find_set(n - 1));
+  EXPECT_EQ(reference.find_set(0), reference.find_set(n - 1));
+}
+
+TEST(compact_disjoint_set, UnionAllMatchesDisjointSet) {
+  std::mt19937 gen(99);
+  const size_t n = 5000;
+  std::uniform_int_distribution<std::uint32_t> element(0, n - 1);
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs(4000);
+  for (auto& pair : pairs)
+    pair = {element(gen), element(gen)};
+
+  compact_disjoint_set d(n);
+  disjoint_set expected(n);
+  size_t expected_unions = 0;
+  for (const auto& pair : pairs)
+    expected_unions += expected.union_set(pair.first, pair.second);
+
+  EXPECT_EQ(expected_unions, d.union_all(pairs));
+  EXPECT_EQ(n - expected_unions, d.num_sets());
+
+  std::vector<size_t> size_of(n, 0);
+  for (size_t x = 0; x != n; ++x)
+    ++size_of[expected.find_set(x)];
+  for (size_t x = 0; x != n; ++x) {
+    const auto cx = static_cast<std::uint32_t>(x);
+    const auto cy = static_cast<std::uint32_t>((x * 31) % n);
+    EXPECT_EQ(expected.find_set(x) == expected.find_set(cy),
+              d.find_set(cx) == d.find_set(cy));
+    EXPECT_EQ(size_of[expected.find_set(x)], d.set_size(cx));
+  }
+}
@@ -0,0 +1,88 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/data_structure/concurrent_disjoint_set.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/data_structure/disjoint_set.hpp> // disjoint_set
+#include <atomic>                              // atomic
+#include <cstddef>                             // size_t
+#include <random>                              // mt19937
+#include <thread>                              // thread
+#include <utility>                             // pair
+#include <vector>                              // vector
+
+using cpl::concurrent_disjoint_set;
+using cpl::disjoint_set;
+using std::size_t;
+
+TEST(concurrent_disjoint_set, WorksWell) {
+  concurrent_disjoint_set d(8);
+
+  EXPECT_TRUE(d.union_set(2, 3));
+  EXPECT_TRUE(d.union_set(0, 4));
+  EXPECT_TRUE(d.union_set(1, 7));
+  EXPECT_TRUE(d.union_set(5, 4));
+  EXPECT_TRUE(d.union_set(1, 0));
+  EXPECT_FALSE(d.union_set(7, 5));
+
+  EXPECT_EQ(d.find_set(1), d.find_set(4));
+  EXPECT_EQ(d.find_set(4), d.find_set(5));
+  EXPECT_EQ(d.find_set(5), d.find_set(7));
+  EXPECT_NE(d.find_set(7), d.find_set(2));
+  EXPECT_EQ(d.find_set(2), d.find_set(3));
+  EXPECT_NE(d.find_set(3), d.find_set(6));
+  EXPECT_NE(d.find_set(6), d.find_set(0));
+  EXPECT_TRUE(d.same_set(0, 7));
+  EXPECT_FALSE(d.same_set(0, 6));
+}
+
+TEST(concurrent_disjoint_set, RepresentativeIsTheSmallestElement) {
+  concurrent_disjoint_set d(6);
+  d.union_set(5, 3);
+  d.union_set(4, 5);
+  d.union_set(2, 1);
+  EXPECT_EQ(3, d.find_set(4));
+  EXPECT_EQ(3, d.find_set(5));
+  EXPECT_EQ(1, d.find_set(2));
+  EXPECT_EQ(0, d.find_set(0));
+}
+
+TEST(concurrent_disjoint_set, WorksFromSeveralThreads) {
+  const size_t n = 20000, num_pairs = 30000, num_threads = 4;
+  std::mt19937 gen(2024);
+  std::uniform_int_distribution<size_t> element(0, n - 1);
+  std::vector<std::pair<size_t, size_t>> pairs(num_pairs);
+  for (auto& pair : pairs)
+    pair = {element(gen), element(gen)};
+
+  concurrent_disjoint_set shared(n);
+  std::atomic<size_t> num_unions(0);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t != num_threads; ++t) {
+    threads.emplace_back([&, t] {
+      // Interleaved chunks, with finds mixed in.
+      for (size_t i = t; i < num_pairs; i += num_threads) {
+        if (shared.union_set(pairs[i].first, pairs[i].second))
+          ++num_unions;
+        shared.find_set(pairs[num_pairs - 1 - i].first);
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  disjoint_set expected(n);
+  size_t expected_unions = 0;
+  for (const auto& pair : pairs)
+    expected_unions += expected.union_set(pair.first, pair.second);
+
+  EXPECT_EQ(expected_unions, num_unions.load());
+  for (size_t x = 0; x != n; ++x) {
+    const size_t y = (x * 7919) % n;
+    EXPECT_EQ(expected.find_set(x) == expected.find_set(y),
+              shared.same_set(x, y));
+  }
+}
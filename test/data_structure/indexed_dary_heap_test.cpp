@@ -0,0 +1,114 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/data_structure/indexed_dary_heap.hpp>
+#include <gtest/gtest.h>
+
+#include <cstddef>    // size_t
+#include <functional> // greater
+#include <random>     // mt19937, uniform_int_distribution
+#include <vector>     // vector
+
+using cpl::indexed_dary_heap;
+using std::size_t;
+
+TEST(IndexedDaryHeapTest, PushAndPop) {
+  indexed_dary_heap<int, 2> heap(6);
+  EXPECT_TRUE(heap.empty());
+
+  heap.push(3, 30);
+  heap.push(0, 50);
+  heap.push(5, 10);
+  heap.push(1, 40);
+  EXPECT_EQ(4u, heap.size());
+  EXPECT_TRUE(heap.contains(0));
+  EXPECT_FALSE(heap.contains(2));
+  EXPECT_EQ(40, heap.key(1));
+
+  EXPECT_EQ(5u, heap.top());
+  EXPECT_EQ(10, heap.top_key());
+  heap.pop();
+  EXPECT_FALSE(heap.contains(5));
+  EXPECT_EQ(3u, heap.top());
+  heap.pop();
+  EXPECT_EQ(1u, heap.top());
+  heap.pop();
+  EXPECT_EQ(0u, heap.top());
+  heap.pop();
+  EXPECT_TRUE(heap.empty());
+}
+
+TEST(IndexedDaryHeapTest, DecreasesKeys) {
+  indexed_dary_heap<int, 4> heap(5);
+  for (size_t i = 0; i != 5; ++i)
+    heap.push(i, 100 + static_cast<int>(i));
+
+  heap.decrease_key(4, 1);
+  heap.push_or_decrease(2, 50);
+  EXPECT_EQ(4u, heap.top());
+  heap.pop();
+  EXPECT_EQ(2u, heap.top());
+  EXPECT_EQ(50, heap.top_key());
+  heap.pop();
+
+  heap.push_or_decrease(4, 7);
+  EXPECT_EQ(4u, heap.top());
+  EXPECT_EQ(4u, heap.size());
+
+  heap.clear();
+  EXPECT_TRUE(heap.empty());
+  EXPECT_FALSE(heap.contains(0));
+  heap.resize(10);
+  heap.push(9, 3);
+  EXPECT_EQ(9u, heap.top());
+}
+
+TEST(IndexedDaryHeapTest, SupportsCustomComparators) {
+  indexed_dary_heap<int, 3, std::greater<int>> heap(3);
+  heap.push(0, 1);
+  heap.push(1, 3);
+  heap.push(2, 2);
+  EXPECT_EQ(1u, heap.top());
+  heap.decrease_key(0, 5); // 'Decrease' according to std::greater.
+  EXPECT_EQ(0u, heap.top());
+}
+
+template <size_t Arity>
+static void check_random_operations() {
+  const size_t num_items = 200;
+  std::mt19937 gen(Arity);
+  std::uniform_int_distribution<size_t> item_dist(0, num_items - 1);
+  std::uniform_int_distribution<int> key_dist(0, 1000);
+
+  indexed_dary_heap<int, Arity> heap(num_items);
+  std::vector<int> key(num_items);
+  std::vector<bool> queued(num_items);
+
+  for (int step = 0; step != 3000; ++step) {
+    const size_t item = item_dist(gen);
+    if (step % 4 == 3 && !heap.empty()) {
+      size_t best = num_items;
+      for (size_t i = 0; i != num_items; ++i)
+        if (queued[i] && (best == num_items || key[i] < key[best]))
+          best = i;
+      ASSERT_EQ(key[best], heap.top_key());
+      queued[heap.top()] = false;
+      heap.pop();
+    } else if (!queued[item]) {
+      key[item] = key_dist(gen);
+      queued[item] = true;
+      heap.push(item, key[item]);
+    } else if (key[item] > 0) {
+      key[item] -= std::uniform_int_distribution<int>(0, key[item])(gen);
+      heap.decrease_key(item, key[item]);
+    }
+  }
+}
+
+TEST(IndexedDaryHeapTest, WorksWithDifferentArities) {
+  check_random_operations<2>();
+  check_random_operations<4>();
+  check_random_operations<8>();
+}
@@ -0,0 +1,82 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/data_structure/radix_heap.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm> // sort
+#include <cstdint>   // uint8_t, uint64_t
+#include <random>    // mt19937, uniform_int_distribution
+#include <vector>    // vector
+
+using cpl::radix_heap;
+
+TEST(RadixHeapTest, ExtractsInOrder) {
+  radix_heap<unsigned, char> heap;
+  EXPECT_TRUE(heap.empty());
+
+  heap.push(5, 'a');
+  heap.push(3, 'b');
+  heap.push(9, 'c');
+  heap.push(3, 'd');
+  EXPECT_EQ(4u, heap.size());
+
+  EXPECT_EQ(3u, heap.top().first);
+  heap.pop();
+  EXPECT_EQ(3u, heap.top().first);
+  heap.pop();
+
+  heap.push(4, 'e');
+  EXPECT_EQ(4u, heap.top().first);
+  EXPECT_EQ('e', heap.top().second);
+  heap.pop();
+  EXPECT_EQ(5u, heap.top().first);
+  EXPECT_EQ('a', heap.top().second);
+  heap.pop();
+  EXPECT_EQ(9u, heap.top().first);
+  EXPECT_EQ('c', heap.top().second);
+  heap.pop();
+  EXPECT_TRUE(heap.empty());
+}
+
+TEST(RadixHeapTest, HandlesExtremeKeys) {
+  radix_heap<uint8_t, int> heap;
+  heap.push(255, 1);
+  heap.push(0, 2);
+  heap.push(128, 3);
+  EXPECT_EQ(0, heap.top().first);
+  heap.pop();
+  EXPECT_EQ(128, heap.top().first);
+  heap.pop();
+  heap.push(128, 4);
+  EXPECT_EQ(128, heap.top().first);
+  heap.pop();
+  EXPECT_EQ(255, heap.top().first);
+  heap.pop();
+  EXPECT_TRUE(heap.empty());
+}
+
+TEST(RadixHeapTest, WorksAsMonotoneQueue) {
+  std::mt19937 gen(1234);
+  std::uniform_int_distribution<uint64_t> delta_dist(0, 1000);
+
+  radix_heap<uint64_t, int> heap;
+  std::vector<uint64_t> pending;
+  uint64_t last = 0;
+  for (int step = 0; step != 5000; ++step) {
+    if (pending.empty() || step % 3 != 0) {
+      const uint64_t key = last + delta_dist(gen);
+      heap.push(key, step);
+      pending.push_back(key);
+      continue;
+    }
+    std::sort(pending.begin(), pending.end());
+    ASSERT_EQ(pending.front(), heap.top().first);
+    last = heap.top().first;
+    heap.pop();
+    pending.erase(pending.begin());
+    EXPECT_EQ(pending.size(), heap.size());
+  }
+}
@@ -0,0 +1,76 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/data_structure/rollback_disjoint_set.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/data_structure/disjoint_set.hpp> // disjoint_set
+#include <cstddef>                             // size_t
+#include <random>                              // mt19937
+#include <utility>                             // pair
+#include <vector>                              // vector
+
+using cpl::disjoint_set;
+using cpl::rollback_disjoint_set;
+using std::size_t;
+
+TEST(rollback_disjoint_set, WorksWell) {
+  rollback_disjoint_set d(8);
+
+  EXPECT_TRUE(d.union_set(2, 3));
+  EXPECT_TRUE(d.union_set(0, 4));
+  const size_t snapshot = d.snapshot();
+  EXPECT_TRUE(d.union_set(1, 7));
+  EXPECT_TRUE(d.union_set(5, 4));
+  EXPECT_TRUE(d.union_set(1, 0));
+  EXPECT_FALSE(d.union_set(7, 5));
+  EXPECT_EQ(3, d.num_sets());
+  EXPECT_EQ(d.find_set(1), d.find_set(5));
+
+  d.rollback(snapshot);
+  EXPECT_EQ(6, d.num_sets());
+  EXPECT_EQ(d.find_set(0), d.find_set(4));
+  EXPECT_EQ(d.find_set(2), d.find_set(3));
+  EXPECT_NE(d.find_set(1), d.find_set(7));
+  EXPECT_NE(d.find_set(5), d.find_set(4));
+  EXPECT_NE(d.find_set(1), d.find_set(0));
+
+  d.rollback(0);
+  EXPECT_EQ(8, d.num_sets());
+  for (size_t x = 0; x != 8; ++x)
+    EXPECT_EQ(x, d.find_set(x));
+}
+
+TEST(rollback_disjoint_set, RollbackRestoresRandomStates) {
+  std::mt19937 gen(4321);
+  const size_t n = 300;
+  std::uniform_int_distribution<size_t> element(0, n - 1);
+  rollback_disjoint_set d(n);
+
+  // Stack of states: the pairs merged so far and the snapshot taken.
+  std::vector<std::pair<size_t, size_t>> pairs;
+  std::vector<std::pair<size_t, size_t>> states; // Snapshot, pairs.size().
+  for (size_t step = 0; step != 400; ++step) {
+    if (step % 7 == 6 && !states.empty()) {
+      d.rollback(states.back().first);
+      pairs.resize(states.back().second);
+      states.pop_back();
+    } else {
+      if (step % 5 == 0)
+        states.emplace_back(d.snapshot(), pairs.size());
+      pairs.emplace_back(element(gen), element(gen));
+      d.union_set(pairs.back().first, pairs.back().second);
+    }
+
+    disjoint_set expected(n);
+    size_t num_sets = n;
+    for (const auto& pair : pairs)
+      num_sets -= expected.union_set(pair.first, pair.second);
+    ASSERT_EQ(num_sets, d.num_sets());
+    for (size_t x = 0; x < n; x += 7)
+      ASSERT_EQ(expected.find_set(x) == expected.find_set(n - 1 - x),
+                d.find_set(x) == d.find_set(n - 1 - x));
+  }
+}
@@ -0,0 +1,96 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/astar_shortest_path.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/dijkstra_shortest_paths.hpp> // dijkstra_shortest_paths
+#include <cpl/graph/directed_graph.hpp>          // directed_graph
+#include <cstddef>                               // size_t
+#include <cstdlib>                               // abs
+#include <iterator>                              // back_inserter
+#include <limits>                                // numeric_limits
+#include <random>                                // mt19937
+#include <vector>                                // vector
+
+using cpl::astar_shortest_path;
+using cpl::dijkstra_shortest_paths;
+using cpl::directed_graph;
+using std::size_t;
+
+TEST(AstarShortestPathTest, WorksOnGrids) {
+  // Grid with unit horizontal moves and random vertical moves.
+  const int rows = 20, cols = 30;
+  auto id = [&](int r, int c) { return static_cast<size_t>(r * cols + c); };
+  std::mt19937 gen(9);
+  std::uniform_int_distribution<int> weight_dist(1, 9);
+
+  directed_graph graph(rows * cols);
+  std::vector<int> weight_of;
+  for (int r = 0; r != rows; ++r) {
+    for (int c = 0; c != cols; ++c) {
+      if (c + 1 != cols) {
+        graph.add_edge(id(r, c), id(r, c + 1));
+        graph.add_edge(id(r, c + 1), id(r, c));
+        weight_of.insert(weight_of.end(), {1, 1});
+      }
+      if (r + 1 != rows) {
+        graph.add_edge(id(r, c), id(r + 1, c));
+        graph.add_edge(id(r + 1, c), id(r, c));
+        weight_of.push_back(weight_dist(gen));
+        weight_of.push_back(weight_dist(gen));
+      }
+    }
+  }
+
+  const size_t s = id(3, 4);
+  const auto expected = dijkstra_shortest_paths(graph, s, weight_of);
+  for (int r = 0; r != rows; ++r) {
+    for (int c = 0; c != cols; ++c) {
+      // Manhattan distance is admissible and consistent.
+      auto manhattan = [&](size_t v) {
+        const int vr = static_cast<int>(v) / cols;
+        const int vc = static_cast<int>(v) % cols;
+        return std::abs(vr - r) + std::abs(vc - c);
+      };
+      std::vector<size_t> path;
+      EXPECT_EQ(expected[id(r, c)],
+                astar_shortest_path(graph, s, id(r, c), weight_of, manhattan,
+                                    std::back_inserter(path)));
+      ASSERT_FALSE(path.empty());
+      EXPECT_EQ(s, path.front());
+      EXPECT_EQ(id(r, c), path.back());
+    }
+  }
+}
+
+TEST(AstarShortestPathTest, HandlesInconsistentHeuristics) {
+  directed_graph graph(5);
+  std::vector<int> weight_of;
+  auto add_edge = [&](size_t u, size_t v, int weight) {
+    graph.add_edge(u, v);
+    weight_of.push_back(weight);
+  };
+
+  add_edge(0, 1, 1);
+  add_edge(0, 2, 3);
+  add_edge(1, 2, 1);
+  add_edge(2, 3, 5);
+  add_edge(3, 4, 1);
+
+  // Admissible, but h(1) > weight(1, 2) + h(2).
+  const std::vector<int> h = {0, 5, 0, 1, 0};
+  auto heuristic = [&](size_t v) { return h[v]; };
+
+  std::vector<size_t> path;
+  EXPECT_EQ(8, astar_shortest_path(graph, 0, 4, weight_of, heuristic,
+                                   std::back_inserter(path)));
+  EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3, 4}), path);
+
+  auto zero = [](size_t) { return 0; };
+  EXPECT_EQ(std::numeric_limits<int>::max(),
+            astar_shortest_path(graph, 4, 0, weight_of, zero));
+  EXPECT_EQ(0, astar_shortest_path(graph, 2, 2, weight_of, zero));
+}
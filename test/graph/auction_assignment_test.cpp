@@ -0,0 +1,99 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/auction_assignment.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/hungarian_assignment.hpp> // hungarian_assignment
+#include <cpl/utility/matrix.hpp>             // matrix
+#include <algorithm>                          // adjacent_find, sort
+#include <cstddef>                            // size_t
+#include <random>                             // mt19937
+#include <vector>                             // vector
+
+using cpl::auction_assignment;
+using cpl::hungarian_assignment;
+using cpl::matrix;
+using std::size_t;
+
+TEST(AuctionAssignmentTest, WorksOnSmallCase) {
+  matrix<int> cost({3, 3});
+  const int values[3][3] = {{4, 1, 3}, {2, 0, 5}, {3, 2, 2}};
+  for (size_t i = 0; i != 3; ++i)
+    for (size_t j = 0; j != 3; ++j)
+      cost[i][j] = values[i][j];
+
+  std::vector<size_t> assignment;
+  EXPECT_EQ(5, auction_assignment(cost, assignment));
+  EXPECT_EQ(std::vector<size_t>({1, 0, 2}), assignment);
+}
+
+TEST(AuctionAssignmentTest, WorksOnTrivialCases) {
+  std::vector<size_t> assignment;
+  EXPECT_EQ(0, auction_assignment(matrix<int>({0, 0}), assignment));
+  EXPECT_TRUE(assignment.empty());
+
+  EXPECT_EQ(-7, auction_assignment(matrix<int>({1, 1}, -7), assignment));
+  EXPECT_EQ(std::vector<size_t>({0}), assignment);
+}
+
+TEST(AuctionAssignmentTest, MatchesHungarian) {
+  std::mt19937 gen(4004);
+  for (size_t n = 1; n <= 40; n += 3) {
+    // Dense costs and sparse-like costs, where most cells are forbiddingly
+    // expensive.
+    for (const bool sparse : {false, true}) {
+      std::uniform_int_distribution<int> cost_dist(-1000, 1000);
+      std::bernoulli_distribution allowed(0.2);
+      matrix<int> cost({n, n});
+      for (size_t i = 0; i != n; ++i)
+        for (size_t j = 0; j != n; ++j)
+          cost[i][j] = sparse && !allowed(gen) ? 1000000 : cost_dist(gen);
+
+      std::vector<size_t> expected_assignment, assignment;
+      const int total = auction_assignment(cost, assignment);
+      EXPECT_EQ(hungarian_assignment(cost, expected_assignment), total);
+
+      ASSERT_EQ(n, assignment.size());
+      int assigned_cost = 0;
+      for (size_t i = 0; i != n; ++i)
+        assigned_cost += cost[i][assignment[i]];
+      EXPECT_EQ(total, assigned_cost);
+      std::sort(assignment.begin(), assignment.end());
+      EXPECT_TRUE(std::adjacent_find(assignment.begin(), assignment.end()) ==
+                  assignment.end());
+    }
+  }
+}
+
+TEST(AuctionAssignmentTest, ThreadedBiddingMatchesHungarian) {
+  std::mt19937 gen(5005);
+  for (size_t n = 1; n <= 60; n += 7) {
+    for (const bool sparse : {false, true}) {
+      std::uniform_int_distribution<int> cost_dist(-1000, 1000);
+      std::bernoulli_distribution allowed(0.2);
+      matrix<int> cost({n, n});
+      for (size_t i = 0; i != n; ++i)
+        for (size_t j = 0; j != n; ++j)
+          cost[i][j] = sparse && !allowed(gen) ? 1000000 : cost_dist(gen);
+
+      std::vector<size_t> expected_assignment;
+      const int expected = hungarian_assignment(cost, expected_assignment);
+      for (const size_t num_threads : {2, 4}) {
+        std::vector<size_t> assignment;
+        EXPECT_EQ(expected, auction_assignment(cost, assignment, num_threads));
+
+        ASSERT_EQ(n, assignment.size());
+        int assigned_cost = 0;
+        for (size_t i = 0; i != n; ++i)
+          assigned_cost += cost[i][assignment[i]];
+        EXPECT_EQ(expected, assigned_cost);
+        std::sort(assignment.begin(), assignment.end());
+        EXPECT_TRUE(std::adjacent_find(assignment.begin(),
+                                       assignment.end()) == assignment.end());
+      }
+    }
+  }
+}
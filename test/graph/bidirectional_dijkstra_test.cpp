@@ -0,0 +1,97 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/bidirectional_dijkstra.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/csr_graph.hpp>               // csr_directed_graph
+#include <cpl/graph/dijkstra_shortest_paths.hpp> // dijkstra_shortest_paths
+#include <cpl/graph/directed_graph.hpp>          // directed_graph
+#include <cstddef>                               // size_t
+#include <iterator>                              // back_inserter
+#include <limits>                                // numeric_limits
+#include <random>                                // mt19937
+#include <utility>                               // pair
+#include <vector>                                // vector
+
+using cpl::bidirectional_dijkstra;
+using cpl::dijkstra_shortest_paths;
+using cpl::directed_graph;
+using std::size_t;
+
+TEST(BidirectionalDijkstraTest, FindsShortestPaths) {
+  directed_graph graph(7);
+  std::vector<int> weight_of;
+  auto add_edge = [&](size_t u, size_t v, int weight) {
+    graph.add_edge(u, v);
+    weight_of.push_back(weight);
+  };
+
+  add_edge(0, 1, 4);
+  add_edge(0, 2, 1);
+  add_edge(2, 1, 2);
+  add_edge(1, 3, 0);
+  add_edge(3, 4, 5);
+  add_edge(2, 4, 9);
+  add_edge(4, 4, 1);
+  add_edge(5, 0, 1);
+
+  std::vector<size_t> path;
+  EXPECT_EQ(8, bidirectional_dijkstra(graph, 0, 4, weight_of,
+                                      std::back_inserter(path)));
+  EXPECT_EQ((std::vector<size_t>{0, 2, 1, 3, 4}), path);
+
+  path.clear();
+  EXPECT_EQ(0, bidirectional_dijkstra(graph, 3, 3, weight_of,
+                                      std::back_inserter(path)));
+  EXPECT_EQ((std::vector<size_t>{3}), path);
+
+  path.clear();
+  const int inf = std::numeric_limits<int>::max();
+  EXPECT_EQ(inf, bidirectional_dijkstra(graph, 0, 6, weight_of,
+                                        std::back_inserter(path)));
+  EXPECT_TRUE(path.empty());
+  EXPECT_EQ(inf, bidirectional_dijkstra(graph, 4, 0, weight_of));
+}
+
+TEST(BidirectionalDijkstraTest, MatchesDijkstra) {
+  const size_t num_v = 200;
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_int_distribution<int> weight_dist(0, 50);
+
+  std::vector<std::pair<size_t, size_t>> edges;
+  std::vector<int> weight_of;
+  for (size_t i = 0; i != 3 * num_v; ++i) {
+    edges.emplace_back(vertex_dist(gen), vertex_dist(gen));
+    weight_of.push_back(weight_dist(gen));
+  }
+  const cpl::csr_directed_graph graph(num_v, edges);
+
+  for (size_t s = 0; s < num_v; s += 17) {
+    const auto expected = dijkstra_shortest_paths(graph, s, weight_of);
+    for (size_t t = 0; t != num_v; ++t) {
+      std::vector<size_t> path;
+      ASSERT_EQ(expected[t], bidirectional_dijkstra(graph, s, t, weight_of,
+                                                    std::back_inserter(path)));
+      if (path.empty())
+        continue;
+
+      // Checks that the path exists and has the reported length.
+      ASSERT_EQ(s, path.front());
+      ASSERT_EQ(t, path.back());
+      int length = 0;
+      for (size_t i = 0; i + 1 < path.size(); ++i) {
+        int best = std::numeric_limits<int>::max();
+        for (const auto e : graph.out_edges(path[i]))
+          if (graph.target(e) == path[i + 1] && weight_of[e] < best)
+            best = weight_of[e];
+        ASSERT_NE(std::numeric_limits<int>::max(), best);
+        length += best;
+      }
+      EXPECT_EQ(expected[t], length);
+    }
+  }
+}
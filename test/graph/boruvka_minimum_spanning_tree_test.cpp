@@ -0,0 +1,125 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/boruvka_minimum_spanning_tree.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/kruskal_minimum_spanning_tree.hpp>
+#include <cpl/graph/undirected_graph.hpp> // undirected_graph
+#include <cmath>                          // sqrt
+#include <cstddef>                        // size_t
+#include <random>                         // mt19937
+#include <vector>                         // vector
+
+using cpl::boruvka_minimum_spanning_tree;
+using cpl::filter_kruskal_minimum_spanning_tree;
+using cpl::kruskal_minimum_spanning_tree;
+using cpl::undirected_graph;
+using std::size_t;
+using std::vector;
+
+TEST(BoruvkaMinimumSpanningTreeTest, WorksOnEmptyGraph) {
+  undirected_graph graph(0);
+  vector<unsigned> weight;
+  EXPECT_EQ(0, boruvka_minimum_spanning_tree(graph, weight).size());
+}
+
+TEST(BoruvkaMinimumSpanningTreeTest, WorksOnCyclicGraphs) {
+  undirected_graph graph(5);
+  vector<int> weight_of;
+  auto add_edge = [&](size_t u, size_t v, int weight) {
+    graph.add_edge(u, v);
+    weight_of.push_back(weight);
+  };
+  add_edge(0, 2, 8); // 0
+  add_edge(2, 3, 5); // 1
+  add_edge(3, 0, 6); // 2
+  add_edge(1, 3, 3); // 3
+  add_edge(1, 2, 2); // 4
+  add_edge(2, 4, 7); // 5
+  add_edge(1, 4, 4); // 6
+  add_edge(4, 4, 1); // 7
+
+  EXPECT_EQ(vector<size_t>({4, 3, 6, 2}),
+            boruvka_minimum_spanning_tree(graph, weight_of));
+}
+
+TEST(BoruvkaMinimumSpanningTreeTest, BreaksTiesByEdgeIndex) {
+  // A 4-cycle with equal weights. Without a consistent tie breaking, each
+  // vertex could pick a different edge and close the cycle.
+  undirected_graph graph(4);
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 3);
+  graph.add_edge(3, 0);
+  const vector<int> weight_of(4, 7);
+
+  EXPECT_EQ(vector<size_t>({0, 1, 2}),
+            boruvka_minimum_spanning_tree(graph, weight_of));
+}
+
+TEST(BoruvkaMinimumSpanningTreeTest, MatchesKruskalOnRandomGraphs) {
+  std::mt19937 gen(5678);
+  for (size_t rep = 0; rep != 20; ++rep) {
+    const size_t n = 40 + 60 * rep, m = n * (1 + rep % 5) / 2;
+    std::uniform_int_distribution<size_t> vertex(0, n - 1);
+    std::uniform_int_distribution<int> weight(0, 3 + 1000 * (rep % 2));
+    undirected_graph graph(n);
+    vector<int> weight_of;
+    for (size_t i = 0; i != m; ++i) {
+      graph.add_edge(vertex(gen), vertex(gen));
+      weight_of.push_back(weight(gen));
+    }
+
+    const auto tree = boruvka_minimum_spanning_tree(graph, weight_of);
+    EXPECT_EQ(filter_kruskal_minimum_spanning_tree(graph, weight_of), tree);
+    for (const size_t num_threads : {2, 4, 8})
+      EXPECT_EQ(tree,
+                boruvka_minimum_spanning_tree(graph, weight_of, num_threads));
+
+    const auto expected = kruskal_minimum_spanning_tree(graph, weight_of);
+    ASSERT_EQ(expected.size(), tree.size());
+    long long expected_weight = 0, tree_weight = 0;
+    for (size_t i = 0; i != tree.size(); ++i) {
+      expected_weight += weight_of[expected[i]];
+      tree_weight += weight_of[tree[i]];
+    }
+    EXPECT_EQ(expected_weight, tree_weight);
+  }
+}
+
+TEST(BoruvkaMinimumSpanningTreeTest, MatchesKruskalOnGeometricGraphs) {
+  // Points in the unit square, joined when they are closer than 'radius'.
+  std::mt19937 gen(91011);
+  std::uniform_real_distribution<double> coord(0.0, 1.0);
+  for (size_t rep = 0; rep != 5; ++rep) {
+    const size_t n = 200 + 200 * rep;
+    const double radius = 2.0 / std::sqrt(static_cast<double>(n));
+    vector<double> x(n), y(n);
+    for (size_t v = 0; v != n; ++v) {
+      x[v] = coord(gen);
+      y[v] = coord(gen);
+    }
+    undirected_graph graph(n);
+    vector<double> weight_of;
+    for (size_t u = 0; u != n; ++u) {
+      for (size_t v = u + 1; v != n; ++v) {
+        const double dx = x[u] - x[v], dy = y[u] - y[v];
+        const double dist = std::sqrt(dx * dx + dy * dy);
+        if (dist < radius) {
+          graph.add_edge(u, v);
+          weight_of.push_back(dist);
+        }
+      }
+    }
+
+    // Distinct weights, so the MST is unique.
+    const auto expected = kruskal_minimum_spanning_tree(graph, weight_of);
+    EXPECT_EQ(expected, boruvka_minimum_spanning_tree(graph, weight_of));
+    EXPECT_EQ(expected, boruvka_minimum_spanning_tree(graph, weight_of, 3));
+    EXPECT_EQ(expected,
+              filter_kruskal_minimum_spanning_tree(graph, weight_of));
+  }
+}
@@ -9,9 +9,13 @@
 #include <cpl/graph/undirected_graph.hpp> // undirected_graph
 #include <algorithm>                      // max_element
 #include <cstddef>                        // size_t
+#include <cstdint>                        // uint32_t
+#include <random>                         // mt19937
 #include <vector>                         // vector
 
+using cpl::basic_undirected_graph;
 using cpl::connected_components;
+using cpl::union_find_connected_components;
 using cpl::undirected_graph;
 using std::size_t;
 
@@ -27,6 +31,14 @@ static void check_labels(const undirected_graph& graph,
   EXPECT_EQ(num_components, connected_components(graph, component_of));
   EXPECT_EQ(expected.size(), component_of.size());
   EXPECT_EQ(expected, component_of);
+
+  EXPECT_EQ(num_components,
+            union_find_connected_components(graph, component_of));
+  EXPECT_EQ(expected, component_of);
+
+  EXPECT_EQ(num_components,
+            union_find_connected_components(graph, component_of, 3));
+  EXPECT_EQ(expected, component_of);
 }
 
 TEST(ConnectedComponentsTest, WorksOnEmptyGraphs) {
@@ -87,3 +99,66 @@ TEST(ConnectedComponentsTest, WorksOnMultilpleComponentGraphs) {
 
   check_labels(graph, {0, 1, 1, 1, 0, 2, 3, 2, 0, 0, 2, 2, 2, 4});
 }
+
+TEST(ConnectedComponentsTest, WorksWithNarrowIndexTypes) {
+  basic_undirected_graph<uint32_t> graph(6);
+  graph.add_edge(0, 3);
+  graph.add_edge(3, 5);
+  graph.add_edge(1, 4);
+
+  std::vector<uint32_t> component_of;
+  EXPECT_EQ(3u, connected_components(graph, component_of));
+  EXPECT_EQ(std::vector<uint32_t>({0, 1, 2, 0, 1, 0}), component_of);
+}
+
+TEST(ConnectedComponentsTest, UnionFindMatchesSearch) {
+  std::mt19937 gen(777);
+  for (size_t rep = 0; rep != 30; ++rep) {
+    const size_t n = 1 + 100 * rep;
+    // Around the connectivity threshold, so there are many components.
+    const size_t m = n * (rep % 4) / 3;
+    std::uniform_int_distribution<size_t> vertex(0, n - 1);
+    undirected_graph graph(n);
+    for (size_t i = 0; i != m; ++i)
+      graph.add_edge(vertex(gen), vertex(gen));
+
+    std::vector<size_t> expected, component_of;
+    const size_t num_components = connected_components(graph, expected);
+    EXPECT_EQ(num_components,
+              union_find_connected_components(graph, component_of));
+    EXPECT_EQ(expected, component_of);
+  }
+}
+
+TEST(ConnectedComponentsTest, ParallelUnionFindMatchesSearch) {
+  std::mt19937 gen(2024);
+  for (size_t rep = 0; rep != 20; ++rep) {
+    const size_t n = 1 + 500 * rep;
+    const size_t m = n * (rep % 5) / 4;
+    std::uniform_int_distribution<size_t> vertex(0, n - 1);
+    undirected_graph graph(n);
+    for (size_t i = 0; i != m; ++i)
+      graph.add_edge(vertex(gen), vertex(gen));
+
+    std::vector<size_t> expected, component_of;
+    const size_t num_components = connected_components(graph, expected);
+    for (const size_t num_threads : {1, 2, 4, 8}) {
+      EXPECT_EQ(num_components, union_find_connected_components(
+                                    graph, component_of, num_threads));
+      EXPECT_EQ(expected, component_of);
+    }
+  }
+}
+
+TEST(ConnectedComponentsTest, UnionFindWorksWithNarrowIndexTypes) {
+  basic_undirected_graph<uint32_t> graph(6);
+  graph.add_edge(0, 3);
+  graph.add_edge(5, 3);
+  graph.add_edge(4, 1);
+
+  std::vector<uint32_t> component_of;
+  EXPECT_EQ(3u, union_find_connected_components(graph, component_of));
+  EXPECT_EQ(std::vector<uint32_t>({0, 1, 2, 0, 1, 0}), component_of);
+  EXPECT_EQ(3u, union_find_connected_components(graph, component_of, 2));
+  EXPECT_EQ(std::vector<uint32_t>({0, 1, 2, 0, 1, 0}), component_of);
+}
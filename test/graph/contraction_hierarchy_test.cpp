@@ -0,0 +1,112 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/contraction_hierarchy.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/dijkstra_shortest_paths.hpp> // dijkstra_shortest_paths
+#include <cpl/graph/directed_graph.hpp>          // directed_graph
+#include <cstddef>                               // size_t
+#include <cstdint>                               // uint32_t
+#include <iterator>                              // back_inserter
+#include <limits>                                // numeric_limits
+#include <random>                                // mt19937
+#include <vector>                                // vector
+
+using cpl::contraction_hierarchy;
+using cpl::dijkstra_shortest_paths;
+using cpl::directed_graph;
+using std::size_t;
+
+TEST(ContractionHierarchyTest, AnswersQueries) {
+  directed_graph graph(7);
+  std::vector<int> weight_of;
+  auto add_edge = [&](size_t u, size_t v, int weight) {
+    graph.add_edge(u, v);
+    weight_of.push_back(weight);
+  };
+
+  add_edge(0, 1, 4);
+  add_edge(0, 2, 1);
+  add_edge(2, 1, 2);
+  add_edge(1, 3, 0);
+  add_edge(3, 4, 5);
+  add_edge(2, 4, 9);
+  add_edge(4, 4, 1);
+  add_edge(5, 0, 1);
+  add_edge(0, 1, 2); // Parallel edge.
+
+  contraction_hierarchy<int> ch(graph, weight_of);
+  EXPECT_EQ(7u, ch.num_vertices());
+
+  std::vector<size_t> path;
+  EXPECT_EQ(8, ch.shortest_path(5, 4, std::back_inserter(path)));
+  EXPECT_EQ((std::vector<size_t>{5, 0, 1, 3, 4}), path);
+
+  path.clear();
+  EXPECT_EQ(0, ch.shortest_path(6, 6, std::back_inserter(path)));
+  EXPECT_EQ((std::vector<size_t>{6}), path);
+
+  const int inf = std::numeric_limits<int>::max();
+  path.clear();
+  EXPECT_EQ(inf, ch.shortest_path(4, 0, std::back_inserter(path)));
+  EXPECT_TRUE(path.empty());
+  EXPECT_EQ(inf, ch.distance(0, 6));
+  EXPECT_EQ(2, ch.distance(0, 1));
+  EXPECT_EQ(1, ch.distance(0, 2));
+}
+
+TEST(ContractionHierarchyTest, MatchesDijkstraOnGrids) {
+  // Road-like graph: a grid with random weights and a few long edges.
+  const size_t rows = 15, cols = 20, num_v = rows * cols;
+  std::mt19937 gen(13);
+  std::uniform_int_distribution<int> weight_dist(1, 100);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+
+  cpl::basic_directed_graph<uint32_t> graph(num_v);
+  std::vector<int> weight_of;
+  auto add_edge = [&](size_t u, size_t v) {
+    graph.add_edge(u, v);
+    weight_of.push_back(weight_dist(gen));
+  };
+  for (size_t r = 0; r != rows; ++r) {
+    for (size_t c = 0; c != cols; ++c) {
+      const size_t v = r * cols + c;
+      if (c + 1 != cols) {
+        add_edge(v, v + 1);
+        add_edge(v + 1, v);
+      }
+      if (r + 1 != rows) {
+        add_edge(v, v + cols);
+        add_edge(v + cols, v);
+      }
+    }
+  }
+  for (size_t i = 0; i != 20; ++i)
+    add_edge(vertex_dist(gen), vertex_dist(gen));
+
+  contraction_hierarchy<int, uint32_t> ch(graph, weight_of);
+  for (size_t s = 0; s < num_v; s += 29) {
+    const auto expected = dijkstra_shortest_paths(graph, s, weight_of);
+    for (size_t t = 0; t != num_v; ++t) {
+      std::vector<size_t> path;
+      ASSERT_EQ(expected[t], ch.shortest_path(s, t, std::back_inserter(path)));
+      ASSERT_EQ(s, path.front());
+      ASSERT_EQ(t, path.back());
+
+      // Checks that the unpacked path exists in the original graph.
+      int length = 0;
+      for (size_t i = 0; i + 1 < path.size(); ++i) {
+        int best = std::numeric_limits<int>::max();
+        for (const auto e : graph.out_edges(path[i]))
+          if (graph.target(e) == path[i + 1] && weight_of[e] < best)
+            best = weight_of[e];
+        ASSERT_NE(std::numeric_limits<int>::max(), best);
+        length += best;
+      }
+      EXPECT_EQ(expected[t], length);
+    }
+  }
+}
@@ -0,0 +1,140 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/csr_graph.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/connected_components.hpp>    // connected_components
+#include <cpl/graph/dijkstra_shortest_paths.hpp> // dijkstra_shortest_paths
+#include <cpl/graph/directed_graph.hpp>          // directed_graph
+#include <cpl/graph/strong_components.hpp>       // strong_components
+#include <cpl/graph/undirected_graph.hpp>        // undirected_graph
+#include <cstddef>                               // size_t
+#include <utility>                               // pair
+#include <vector>                                // vector
+
+using cpl::csr_directed_graph;
+using cpl::csr_undirected_graph;
+using cpl::directed_graph;
+using cpl::undirected_graph;
+using std::size_t;
+using std::vector;
+
+using edge_vector = vector<std::pair<size_t, size_t>>;
+
+template <typename Range>
+static vector<size_t> to_vector(const Range& range) {
+  return vector<size_t>(range.begin(), range.end());
+}
+
+TEST(CsrDirectedGraphTest, ConstructWell) {
+  const csr_directed_graph g(4, {});
+  EXPECT_EQ(4u, g.num_vertices());
+  EXPECT_EQ(0u, g.num_edges());
+  for (size_t v = 0; v != g.num_vertices(); ++v) {
+    EXPECT_TRUE(g.out_edges(v).empty());
+    EXPECT_TRUE(g.in_edges(v).empty());
+  }
+}
+
+TEST(CsrDirectedGraphTest, LinksWell) {
+  const csr_directed_graph g(4, {{2, 1}, {0, 1}, {0, 2}, {2, 0}, {3, 3}});
+  EXPECT_EQ(4u, g.num_vertices());
+  EXPECT_EQ(5u, g.num_edges());
+
+  EXPECT_EQ(2u, g.source(0));
+  EXPECT_EQ(1u, g.target(0));
+  EXPECT_EQ(3u, g.source(4));
+  EXPECT_EQ(3u, g.target(4));
+
+  EXPECT_EQ((vector<size_t>{1, 2}), to_vector(g.out_edges(0)));
+  EXPECT_EQ((vector<size_t>{}), to_vector(g.out_edges(1)));
+  EXPECT_EQ((vector<size_t>{0, 3}), to_vector(g.out_edges(2)));
+  EXPECT_EQ((vector<size_t>{4}), to_vector(g.out_edges(3)));
+
+  EXPECT_EQ((vector<size_t>{3}), to_vector(g.in_edges(0)));
+  EXPECT_EQ((vector<size_t>{0, 1}), to_vector(g.in_edges(1)));
+  EXPECT_EQ((vector<size_t>{2}), to_vector(g.in_edges(2)));
+  EXPECT_EQ((vector<size_t>{4}), to_vector(g.in_edges(3)));
+
+  EXPECT_EQ(2u, g.out_degree(0));
+  EXPECT_EQ(0u, g.out_degree(1));
+  EXPECT_EQ(2u, g.in_degree(1));
+  EXPECT_EQ(1u, g.in_degree(3));
+}
+
+TEST(CsrDirectedGraphTest, PreservesEdgeDescriptors) {
+  directed_graph g(5);
+  g.add_edge(3, 4);
+  g.add_edge(2, 1);
+  g.add_edge(0, 1);
+  g.add_edge(4, 3);
+  g.add_edge(0, 2);
+
+  const auto csr = csr_directed_graph::from_graph(g);
+  ASSERT_EQ(g.num_vertices(), csr.num_vertices());
+  ASSERT_EQ(g.num_edges(), csr.num_edges());
+  for (size_t e = 0; e != g.num_edges(); ++e) {
+    EXPECT_EQ(g.source(e), csr.source(e));
+    EXPECT_EQ(g.target(e), csr.target(e));
+  }
+  for (size_t v = 0; v != g.num_vertices(); ++v) {
+    EXPECT_EQ(g.out_edges(v), to_vector(csr.out_edges(v)));
+    EXPECT_EQ(g.in_edges(v), to_vector(csr.in_edges(v)));
+  }
+}
+
+TEST(CsrUndirectedGraphTest, LinksWell) {
+  const csr_undirected_graph g(4, {{0, 1}, {1, 2}, {2, 0}, {3, 3}});
+  EXPECT_EQ(4u, g.num_vertices());
+  EXPECT_EQ(4u, g.num_edges());
+
+  EXPECT_EQ((vector<size_t>{0, 2}), to_vector(g.out_edges(0)));
+  EXPECT_EQ((vector<size_t>{0, 1}), to_vector(g.out_edges(1)));
+  EXPECT_EQ((vector<size_t>{1, 2}), to_vector(g.in_edges(2)));
+  EXPECT_EQ((vector<size_t>{3, 3}), to_vector(g.out_edges(3)));
+  EXPECT_EQ(2u, g.degree(3));
+}
+
+TEST(CsrUndirectedGraphTest, PreservesEdgeDescriptors) {
+  undirected_graph g(5);
+  g.add_edge(0, 1);
+  g.add_edge(3, 4);
+  g.add_edge(1, 2);
+  g.add_edge(2, 2);
+  g.add_edge(0, 2);
+
+  const auto csr = csr_undirected_graph::from_graph(g);
+  ASSERT_EQ(g.num_edges(), csr.num_edges());
+  for (size_t v = 0; v != g.num_vertices(); ++v)
+    EXPECT_EQ(g.out_edges(v), to_vector(csr.out_edges(v)));
+}
+
+TEST(CsrGraphTest, WorksWithGraphAlgorithms) {
+  const edge_vector edges = {{0, 1}, {1, 2}, {2, 0}, {2, 3},
+                             {3, 4}, {4, 3}, {5, 4}};
+  const vector<unsigned> weight = {7, 9, 14, 10, 15, 11, 2};
+
+  directed_graph dg(6);
+  undirected_graph ug(6);
+  for (const auto& edge : edges) {
+    dg.add_edge(edge.first, edge.second);
+    ug.add_edge(edge.first, edge.second);
+  }
+  const csr_directed_graph csr_dg(6, edges);
+  const csr_undirected_graph csr_ug(6, edges);
+
+  EXPECT_EQ(cpl::dijkstra_shortest_paths(dg, 0, weight),
+            cpl::dijkstra_shortest_paths(csr_dg, 0, weight));
+
+  vector<size_t> expected, comp;
+  EXPECT_EQ(cpl::strong_components(dg, expected),
+            cpl::strong_components(csr_dg, comp));
+  EXPECT_EQ(expected, comp);
+
+  EXPECT_EQ(cpl::connected_components(ug, expected),
+            cpl::connected_components(csr_ug, comp));
+  EXPECT_EQ(expected, comp);
+}
@@ -0,0 +1,95 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/delta_stepping_shortest_paths.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/csr_graph.hpp>               // csr_directed_graph
+#include <cpl/graph/dijkstra_shortest_paths.hpp> // dijkstra_shortest_paths
+#include <cpl/graph/directed_graph.hpp>          // directed_graph
+#include <cstddef>                               // size_t
+#include <limits>                                // numeric_limits
+#include <random>                                // mt19937
+#include <utility>                               // pair
+#include <vector>                                // vector
+
+using cpl::delta_stepping_shortest_paths;
+using cpl::dijkstra_shortest_paths;
+using cpl::directed_graph;
+using std::size_t;
+
+TEST(DeltaSteppingShortestPathsTest, WorksOnDirectedGraphs) {
+  directed_graph graph(7);
+  std::vector<int> weight_of;
+  auto add_edge = [&](size_t u, size_t v, int weight) {
+    graph.add_edge(u, v);
+    weight_of.push_back(weight);
+  };
+
+  add_edge(0, 1, 4);
+  add_edge(0, 2, 1);
+  add_edge(2, 1, 2);
+  add_edge(1, 3, 0);
+  add_edge(3, 4, 5);
+  add_edge(2, 4, 9);
+  add_edge(4, 4, 1);
+  add_edge(5, 0, 1);
+
+  const int inf = std::numeric_limits<int>::max();
+  const std::vector<int> expected = {0, 3, 1, 3, 8, inf, inf};
+  for (int delta = 1; delta != 12; ++delta) {
+    EXPECT_EQ(expected, delta_stepping_shortest_paths(graph, 0, weight_of,
+                                                      delta));
+    EXPECT_EQ(expected, delta_stepping_shortest_paths(graph, 0, weight_of,
+                                                      delta, 3));
+  }
+}
+
+TEST(DeltaSteppingShortestPathsTest, MatchesDijkstra) {
+  const size_t num_v = 400;
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_real_distribution<double> weight_dist(0.0, 1.0);
+
+  std::vector<std::pair<size_t, size_t>> edges;
+  std::vector<double> weight_of;
+  for (size_t i = 0; i != 6 * num_v; ++i) {
+    edges.emplace_back(vertex_dist(gen), vertex_dist(gen));
+    weight_of.push_back(weight_dist(gen));
+  }
+  const cpl::csr_directed_graph graph(num_v, edges);
+
+  for (const double delta : {0.01, 0.1, 0.25, 1.0, 5.0}) {
+    for (size_t source = 0; source < num_v; source += 41) {
+      EXPECT_EQ(dijkstra_shortest_paths(graph, source, weight_of),
+                delta_stepping_shortest_paths(graph, source, weight_of, delta));
+    }
+  }
+}
+
+TEST(DeltaSteppingShortestPathsTest, ThreadedMatchesDijkstra) {
+  const size_t num_v = 3000;
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_real_distribution<double> weight_dist(0.0, 1.0);
+
+  std::vector<std::pair<size_t, size_t>> edges;
+  std::vector<double> weight_of;
+  for (size_t i = 0; i != 8 * num_v; ++i) {
+    edges.emplace_back(vertex_dist(gen), vertex_dist(gen));
+    weight_of.push_back(weight_dist(gen));
+  }
+  const cpl::csr_directed_graph graph(num_v, edges);
+
+  for (const double delta : {0.05, 0.3, 2.0}) {
+    for (size_t source = 0; source < num_v; source += 701) {
+      const auto expected = dijkstra_shortest_paths(graph, source, weight_of);
+      for (const size_t num_threads : {1, 2, 4, 8}) {
+        EXPECT_EQ(expected, delta_stepping_shortest_paths(
+                                graph, source, weight_of, delta, num_threads));
+      }
+    }
+  }
+}
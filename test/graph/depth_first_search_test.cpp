@@ -0,0 +1,142 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/depth_first_search.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/bridges.hpp>           // find_bridges
+#include <cpl/graph/directed_graph.hpp>    // directed_graph
+#include <cpl/graph/strong_components.hpp> // strong_components
+#include <cpl/graph/topological_sort.hpp>  // topological_sort
+#include <cpl/graph/undirected_graph.hpp>  // undirected_graph
+#include <cstddef>                         // size_t
+#include <string>                          // string, to_string
+#include <vector>                          // vector
+
+using cpl::depth_first_search;
+using cpl::depth_first_visit;
+using cpl::dfs_color;
+using cpl::dfs_visitor;
+using cpl::directed_graph;
+using cpl::undirected_graph;
+using std::size_t;
+using std::string;
+using std::vector;
+
+namespace {
+
+class recorder_visitor : public dfs_visitor {
+public:
+  explicit recorder_visitor(string& log_) : log(log_) {}
+
+  void start_vertex(const size_t v) {
+    log += "s" + std::to_string(v) + ' ';
+  }
+  void discover_vertex(const size_t v) {
+    log += "d" + std::to_string(v) + ' ';
+  }
+  void tree_edge(const size_t e, size_t, size_t) {
+    log += "t" + std::to_string(e) + ' ';
+  }
+  void back_edge(const size_t e, size_t, size_t) {
+    log += "b" + std::to_string(e) + ' ';
+  }
+  void forward_or_cross_edge(const size_t e, size_t, size_t) {
+    log += "c" + std::to_string(e) + ' ';
+  }
+  void finish_edge(const size_t e, size_t, size_t) {
+    log += "x" + std::to_string(e) + ' ';
+  }
+  void finish_vertex(const size_t v) {
+    log += "f" + std::to_string(v) + ' ';
+  }
+
+private:
+  string& log;
+};
+
+class stop_at_visitor : public dfs_visitor {
+public:
+  explicit stop_at_visitor(size_t target_) : target{target_} {}
+
+  void discover_vertex(const size_t v) {
+    found = found || v == target;
+  }
+  bool done() const {
+    return found;
+  }
+
+private:
+  size_t target;
+  bool found = false;
+};
+
+} // end anonymous namespace
+
+TEST(DepthFirstSearchTest, ReportsEventsInOrder) {
+  directed_graph g(5);
+  g.add_edge(0, 1); // tree
+  g.add_edge(1, 2); // tree
+  g.add_edge(2, 0); // back
+  g.add_edge(0, 2); // forward
+  g.add_edge(3, 1); // cross
+  g.add_edge(3, 3); // loop
+
+  string log;
+  recorder_visitor vis(log);
+  EXPECT_TRUE(depth_first_search(g, vis));
+  EXPECT_EQ("s0 d0 t0 d1 t1 d2 b2 f2 x1 f1 x0 c3 f0 "
+            "s3 d3 c4 b5 f3 "
+            "s4 d4 f4 ",
+            log);
+}
+
+TEST(DepthFirstSearchTest, ReportsParentEdgesOnUndirectedGraphs) {
+  undirected_graph g(3);
+  g.add_edge(0, 1);
+  g.add_edge(2, 1);
+
+  string log;
+  recorder_visitor vis(log);
+  vector<dfs_color> color(3, dfs_color::white);
+  EXPECT_TRUE(depth_first_visit(g, 1, vis, color));
+  EXPECT_EQ("d1 t0 d0 b0 f0 x0 t1 d2 b1 f2 x1 f1 ", log);
+  EXPECT_EQ(vector<dfs_color>(3, dfs_color::black), color);
+}
+
+TEST(DepthFirstSearchTest, StopsWhenVisitorIsDone) {
+  directed_graph g(4);
+  g.add_edge(0, 1);
+  g.add_edge(1, 2);
+  g.add_edge(2, 3);
+
+  stop_at_visitor vis(2);
+  vector<dfs_color> color(4, dfs_color::white);
+  EXPECT_FALSE(depth_first_visit(g, 0, vis, color));
+  EXPECT_EQ(dfs_color::white, color[3]);
+}
+
+TEST(DepthFirstSearchTest, HandlesDeepGraphs) {
+  const size_t num_v = 1000000;
+  directed_graph dg(num_v);
+  undirected_graph ug(num_v);
+  for (size_t v = 0; v + 1 != num_v; ++v) {
+    dg.add_edge(v, v + 1);
+    ug.add_edge(v, v + 1);
+  }
+
+  const auto order = cpl::topological_sort(dg);
+  ASSERT_EQ(num_v, order.size());
+  EXPECT_EQ(0u, order.front());
+  EXPECT_EQ(num_v - 1, order.back());
+
+  dg.add_edge(num_v - 1, 0);
+  vector<size_t> comp;
+  EXPECT_EQ(1u, cpl::strong_components(dg, comp));
+
+  size_t num_bridges = 0;
+  cpl::find_bridges(ug, [&](size_t) { ++num_bridges; });
+  EXPECT_EQ(num_v - 1, num_bridges);
+}
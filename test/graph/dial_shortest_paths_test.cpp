@@ -0,0 +1,70 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/dial_shortest_paths.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/dijkstra_shortest_paths.hpp> // dijkstra_shortest_paths
+#include <cpl/graph/directed_graph.hpp>          // directed_graph
+#include <cstddef>                               // size_t
+#include <limits>                                // numeric_limits
+#include <random>                                // mt19937
+#include <vector>                                // vector
+
+using cpl::dial_shortest_paths;
+using cpl::dijkstra_shortest_paths;
+using cpl::directed_graph;
+using std::size_t;
+
+TEST(DialShortestPathsTest, WorksOnDirectedGraphs) {
+  directed_graph graph(7);
+  std::vector<unsigned> weight_of;
+  auto add_edge = [&](size_t u, size_t v, unsigned weight) {
+    graph.add_edge(u, v);
+    weight_of.push_back(weight);
+  };
+
+  add_edge(0, 1, 4);
+  add_edge(0, 2, 1);
+  add_edge(2, 1, 2);
+  add_edge(1, 3, 0);
+  add_edge(3, 4, 5);
+  add_edge(2, 4, 9);
+  add_edge(4, 4, 1);
+  add_edge(5, 0, 1);
+
+  const unsigned inf = std::numeric_limits<unsigned>::max();
+  const std::vector<unsigned> expected = {0, 3, 1, 3, 8, inf, inf};
+  EXPECT_EQ(expected, dial_shortest_paths(graph, 0, weight_of));
+}
+
+TEST(DialShortestPathsTest, MatchesDijkstra) {
+  const size_t num_v = 300;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_int_distribution<int> weight_dist(0, 20);
+
+  directed_graph graph(num_v);
+  std::vector<int> int_weight;
+  std::vector<double> real_weight;
+  for (size_t i = 0; i != 4 * num_v; ++i) {
+    graph.add_edge(vertex_dist(gen), vertex_dist(gen));
+    int_weight.push_back(weight_dist(gen));
+    real_weight.push_back(int_weight.back());
+  }
+
+  for (size_t source = 0; source < num_v; source += 37) {
+    const auto expected = dijkstra_shortest_paths(graph, source, real_weight);
+    const auto radix_dist = dijkstra_shortest_paths(graph, source, int_weight);
+    const auto dial_dist = dial_shortest_paths(graph, source, int_weight);
+    for (size_t v = 0; v != num_v; ++v) {
+      const int inf = std::numeric_limits<int>::max();
+      const bool reachable =
+          expected[v] != std::numeric_limits<double>::max();
+      EXPECT_EQ(reachable ? static_cast<int>(expected[v]) : inf, radix_dist[v]);
+      EXPECT_EQ(radix_dist[v], dial_dist[v]);
+    }
+  }
+}
@@ -6,12 +6,17 @@
 #include <cpl/graph/dijkstra_shortest_paths.hpp>
 #include <gtest/gtest.h>
 
-#include <cpl/graph/directed_graph.hpp> // directed_graph
-#include <cstddef>                      // size_t
-#include <vector>                       // vector
+#include <cpl/data_structure/indexed_dary_heap.hpp> // indexed_dary_heap
+#include <cpl/graph/directed_graph.hpp>             // directed_graph
+#include <cstddef>                                  // size_t
+#include <cstdint>                                  // uint32_t
+#include <random>                                   // mt19937
+#include <vector>                                   // vector
 
+using cpl::basic_directed_graph;
 using cpl::dijkstra_shortest_paths;
 using cpl::directed_graph;
+using cpl::indexed_dary_heap;
 using std::size_t;
 
 TEST(DijkstraShortestPathsTest, WorksOnDirectedGraphs) {
@@ -40,6 +45,61 @@ TEST(DijkstraShortestPathsTest, WorksOnDirectedGraphs) {
   EXPECT_EQ(expected, spaths);
 }
 
+TEST(DijkstraShortestPathsTest, WorksWithNarrowIndexTypes) {
+  basic_directed_graph<uint32_t> graph(4);
+  const std::vector<unsigned> weight_of = {5, 1, 1, 7};
+  graph.add_edge(0, 1);
+  graph.add_edge(0, 2);
+  graph.add_edge(2, 1);
+  graph.add_edge(1, 3);
+
+  const std::vector<unsigned> expected = {0, 2, 1, 9};
+  EXPECT_EQ(expected, dijkstra_shortest_paths(graph, 0, weight_of));
+}
+
+TEST(DijkstraShortestPathsTest, WorksWithBoolDistances) {
+  // A false weight is a free edge, so false distances mark the vertices
+  // reachable through free edges only.
+  directed_graph graph(5);
+  const std::vector<bool> weight_of = {false, true, false, false};
+  graph.add_edge(0, 1);
+  graph.add_edge(0, 2);
+  graph.add_edge(1, 3);
+  graph.add_edge(2, 4);
+
+  const std::vector<bool> expected = {false, false, true, false, true};
+  EXPECT_EQ(expected, dijkstra_shortest_paths(graph, 0, weight_of));
+}
+
+TEST(DijkstraShortestPathsTest, IndexedHeapsGiveSameResults) {
+  const size_t num_v = 200;
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_real_distribution<double> weight_dist(0.0, 10.0);
+
+  for (const size_t num_e : {num_v, 5 * num_v, 40 * num_v}) {
+    directed_graph graph(num_v);
+    std::vector<double> weight_of;
+    for (size_t i = 0; i != num_e; ++i) {
+      graph.add_edge(vertex_dist(gen), vertex_dist(gen));
+      weight_of.push_back(weight_dist(gen));
+    }
+
+    indexed_dary_heap<double, 2> heap2;
+    indexed_dary_heap<double, 4> heap4;
+    indexed_dary_heap<double, 8> heap8;
+    for (size_t source = 0; source < num_v; source += 23) {
+      const auto expected = dijkstra_shortest_paths(graph, source, weight_of);
+      EXPECT_EQ(expected,
+                dijkstra_shortest_paths(graph, source, weight_of, heap2));
+      EXPECT_EQ(expected,
+                dijkstra_shortest_paths(graph, source, weight_of, heap4));
+      EXPECT_EQ(expected,
+                dijkstra_shortest_paths(graph, source, weight_of, heap8));
+    }
+  }
+}
+
 // Complexity: O(V*avg_degree)
 // It might generate parallel edges.
 // You can visualize the generated graph on http://g.ivank.net/
@@ -6,8 +6,12 @@
 #include <cpl/graph/directed_graph.hpp>
 #include <gtest/gtest.h>
 
-#include <cstddef> // size_t
+#include <cstddef>     // size_t
+#include <cstdint>     // uint32_t
+#include <type_traits> // is_same
+#include <vector>      // vector
 
+using cpl::basic_directed_graph;
 using cpl::directed_graph;
 using std::size_t;
 
@@ -69,3 +73,20 @@ TEST(DirectedGraphTest, LinksWell) {
   EXPECT_FALSE(connects_to(3, 1));
   EXPECT_FALSE(connects_to(1, 3));
 }
+
+TEST(DirectedGraphTest, SupportsNarrowIndexTypes) {
+  basic_directed_graph<uint32_t> graph(4);
+  static_assert(std::is_same<decltype(graph.add_edge(0, 1)), uint32_t>::value,
+                "Descriptors must be stored with the index type");
+
+  EXPECT_EQ(0u, graph.add_edge(0, 1));
+  EXPECT_EQ(1u, graph.add_edge(2, 1));
+  EXPECT_EQ(2u, graph.add_edge(1, 3));
+
+  EXPECT_EQ(4u, graph.num_vertices());
+  EXPECT_EQ(3u, graph.num_edges());
+  EXPECT_EQ(2u, graph.source(1));
+  EXPECT_EQ(1u, graph.target(1));
+  EXPECT_EQ(std::vector<uint32_t>({0, 1}), graph.in_edges(1));
+  EXPECT_EQ(std::vector<uint32_t>({2}), graph.out_edges(1));
+}
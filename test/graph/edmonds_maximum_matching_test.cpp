@@ -0,0 +1,189 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/edmonds_maximum_matching.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/hopcroft_karp_maximum_matching.hpp>
+#include <cpl/graph/undirected_graph.hpp> // undirected_graph
+#include <algorithm>                      // max
+#include <cstddef>                        // size_t
+#include <limits>                         // numeric_limits
+#include <random>                         // mt19937
+#include <utility>                        // pair
+#include <vector>                         // vector
+
+using cpl::edmonds_maximum_matching;
+using cpl::hopcroft_karp_maximum_matching;
+using cpl::undirected_graph;
+using std::size_t;
+
+namespace {
+
+const size_t nil = std::numeric_limits<size_t>::max();
+
+// Checks that 'mate' is a matching of 'graph' with 'size' edges.
+void check_matching(const undirected_graph& graph,
+                    const std::vector<size_t>& mate, const size_t size) {
+  ASSERT_EQ(graph.num_vertices(), mate.size());
+  size_t num_matched = 0;
+  for (size_t v = 0; v != mate.size(); ++v) {
+    if (mate[v] == nil)
+      continue;
+    ++num_matched;
+    ASSERT_EQ(v, mate[mate[v]]);
+    bool adjacent = false;
+    for (const auto e : graph.out_edges(v))
+      adjacent |= graph.source(e) + graph.target(e) - v == mate[v];
+    EXPECT_TRUE(adjacent);
+  }
+  EXPECT_EQ(2 * size, num_matched);
+}
+
+// Exhaustive search over the subsets of vertices.
+size_t
+brute_force_matching(const size_t n,
+                     const std::vector<std::pair<size_t, size_t>>& edges) {
+  std::vector<unsigned> adjacent(n, 0);
+  for (const auto& edge : edges) {
+    adjacent[edge.first] |= 1u << edge.second;
+    adjacent[edge.second] |= 1u << edge.first;
+  }
+  // best[mask] is the maximum matching among the vertices in 'mask'.
+  std::vector<size_t> best(size_t(1) << n, 0);
+  for (unsigned mask = 1; mask != best.size(); ++mask) {
+    size_t v = 0;
+    while (!(mask >> v & 1))
+      ++v;
+    const unsigned rest = mask & ~(1u << v);
+    best[mask] = best[rest];
+    for (size_t u = 0; u != n; ++u)
+      if ((rest & adjacent[v]) >> u & 1)
+        best[mask] = std::max(best[mask], 1 + best[rest & ~(1u << u)]);
+  }
+  return best.back();
+}
+
+} // end anonymous namespace
+
+TEST(EdmondsMaximumMatchingTest, WorksOnDisconnectedGraphs) {
+  undirected_graph graph(20);
+  std::vector<size_t> mate;
+  EXPECT_EQ(0, edmonds_maximum_matching(graph, mate));
+  EXPECT_EQ(std::vector<size_t>(20, nil), mate);
+}
+
+TEST(EdmondsMaximumMatchingTest, WorksOnOddCycles) {
+  undirected_graph graph(7);
+  for (size_t v = 0; v != 7; ++v)
+    graph.add_edge(v, (v + 1) % 7);
+  std::vector<size_t> mate;
+  EXPECT_EQ(3, edmonds_maximum_matching(graph, mate));
+  check_matching(graph, mate, 3);
+}
+
+TEST(EdmondsMaximumMatchingTest, ExpandsBlossoms) {
+  // A triangle 1-2-3 with two pendant vertices. The greedy matching takes
+  // 0-1 and 2-3, and 4-5 needs an augmenting path through the blossom.
+  undirected_graph graph(7);
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 3);
+  graph.add_edge(3, 1);
+  graph.add_edge(3, 4);
+  graph.add_edge(5, 0);
+  graph.add_edge(4, 6);
+
+  std::vector<size_t> mate;
+  EXPECT_EQ(3, edmonds_maximum_matching(graph, mate));
+  check_matching(graph, mate, 3);
+}
+
+TEST(EdmondsMaximumMatchingTest, WorksOnThePetersenGraph) {
+  undirected_graph graph(10);
+  for (size_t v = 0; v != 5; ++v) {
+    graph.add_edge(v, (v + 1) % 5);
+    graph.add_edge(v, v + 5);
+    graph.add_edge(v + 5, (v + 2) % 5 + 5);
+  }
+  std::vector<size_t> mate;
+  EXPECT_EQ(5, edmonds_maximum_matching(graph, mate));
+  check_matching(graph, mate, 5);
+}
+
+TEST(EdmondsMaximumMatchingTest, WorksOnNestedBlossoms) {
+  // A chain of triangles joined by their tips, with a free vertex at each
+  // end. Every augmenting path crosses all the triangles.
+  const size_t num_triangles = 2000;
+  const size_t n = 3 * num_triangles + 2;
+  undirected_graph graph(n);
+  for (size_t t = 0; t != num_triangles; ++t) {
+    const size_t a = 3 * t + 1, b = a + 1, c = a + 2;
+    graph.add_edge(a, b);
+    graph.add_edge(b, c);
+    graph.add_edge(c, a);
+    graph.add_edge(a - 1, a);
+  }
+  graph.add_edge(n - 2, n - 1);
+
+  std::vector<size_t> mate;
+  EXPECT_EQ(n / 2, edmonds_maximum_matching(graph, mate));
+  check_matching(graph, mate, n / 2);
+}
+
+TEST(EdmondsMaximumMatchingTest, MatchesBruteForce) {
+  std::mt19937 gen(1729);
+  for (size_t rep = 0; rep != 300; ++rep) {
+    const size_t n = 1 + rep % 12;
+    std::bernoulli_distribution connect(0.1 + 0.05 * (rep % 8));
+    undirected_graph graph(n);
+    std::vector<std::pair<size_t, size_t>> edges;
+    for (size_t u = 0; u != n; ++u) {
+      for (size_t v = u + 1; v != n; ++v) {
+        if (connect(gen)) {
+          rep % 2 ? graph.add_edge(u, v) : graph.add_edge(v, u);
+          edges.emplace_back(u, v);
+        }
+      }
+    }
+
+    std::vector<size_t> mate;
+    const size_t size = edmonds_maximum_matching(graph, mate);
+    EXPECT_EQ(brute_force_matching(n, edges), size);
+    check_matching(graph, mate, size);
+  }
+}
+
+TEST(EdmondsMaximumMatchingTest, MatchesHopcroftKarpOnBipartiteGraphs) {
+  std::mt19937 gen(31415);
+  for (size_t rep = 0; rep != 20; ++rep) {
+    const size_t num_a = 500, n = 1000;
+    std::uniform_int_distribution<size_t> side(0, num_a - 1);
+    undirected_graph graph(n);
+    for (size_t i = 0; i != 2 * n; ++i)
+      graph.add_edge(side(gen), num_a + side(gen));
+
+    std::vector<size_t> mate;
+    const size_t size = edmonds_maximum_matching(graph, mate);
+    EXPECT_EQ(hopcroft_karp_maximum_matching(graph), size);
+    check_matching(graph, mate, size);
+  }
+}
+
+TEST(EdmondsMaximumMatchingTest, WorksOnLargeSparseGraphs) {
+  // Many short odd cycles and long augmenting paths once the greedy matching
+  // is done.
+  std::mt19937 gen(4242);
+  const size_t n = 20000;
+  std::uniform_int_distribution<size_t> vertex(0, n - 1);
+  undirected_graph graph(n);
+  for (size_t i = 0; i != 2 * n; ++i)
+    graph.add_edge(vertex(gen), vertex(gen));
+
+  std::vector<size_t> mate;
+  const size_t size = edmonds_maximum_matching(graph, mate);
+  check_matching(graph, mate, size);
+  EXPECT_GT(size, n / 3);
+}
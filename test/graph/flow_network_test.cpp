@@ -0,0 +1,141 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/flow_network.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/dinic_max_flow.hpp>        // dinic_max_flow
+#include <cpl/graph/directed_graph.hpp>        // directed_graph
+#include <cpl/graph/edmonds_karp_max_flow.hpp> // edmonds_karp_max_flow
+#include <cpl/graph/gusfield_all_pairs_min_cut.hpp>
+#include <cpl/graph/min_st_cut.hpp>            // min_st_cut
+#include <cpl/graph/push_relabel_max_flow.hpp> // push_relabel_max_flow
+#include <cstddef>                             // size_t
+#include <cstdint>                             // uint32_t
+#include <random>                              // mt19937
+#include <vector>                              // vector
+
+using cpl::flow_network;
+using cpl::directed_graph;
+using cpl::edmonds_karp_max_flow;
+using cpl::dinic_max_flow;
+using cpl::push_relabel_max_flow;
+using cpl::min_st_cut;
+using cpl::gusfield_all_pairs_min_cut;
+using std::size_t;
+
+TEST(FlowNetworkTest, StoresEdgePairs) {
+  flow_network<int, std::uint32_t> net(3);
+  EXPECT_EQ(0, net.add_edge(0, 1, 5));
+  EXPECT_EQ(2, net.add_edge(2, 1, 3, 4));
+
+  EXPECT_EQ(3, net.num_vertices());
+  EXPECT_EQ(4, net.num_edges());
+
+  EXPECT_EQ(0, net.source(0));
+  EXPECT_EQ(1, net.target(0));
+  EXPECT_EQ(1, net.source(1));
+  EXPECT_EQ(0, net.target(1));
+  EXPECT_EQ(1, net.reverse(0));
+  EXPECT_EQ(2, net.reverse(3));
+
+  EXPECT_EQ(5, net.capacity(0));
+  EXPECT_EQ(0, net.capacity(1));
+  EXPECT_EQ(3, net.capacity(2));
+  EXPECT_EQ(4, net.capacity(3));
+
+  EXPECT_EQ(std::vector<std::uint32_t>({0}), net.out_edges(0));
+  EXPECT_EQ(std::vector<std::uint32_t>({1, 3}), net.out_edges(1));
+  EXPECT_EQ(std::vector<std::uint32_t>({2}), net.out_edges(2));
+}
+
+TEST(FlowNetworkTest, ResetRestoresCapacities) {
+  flow_network<int> net(3);
+  net.add_edge(0, 1, 5);
+  net.add_edge(1, 2, 3);
+
+  EXPECT_EQ(3, edmonds_karp_max_flow(net, 0, 2));
+  EXPECT_EQ(3, net.flow(0));
+  EXPECT_EQ(-3, net.flow(1));
+  EXPECT_EQ(2, net.residual(0));
+  EXPECT_EQ(3, net.residual(1));
+
+  net.reset();
+  for (size_t e = 0; e != net.num_edges(); ++e) {
+    EXPECT_EQ(net.capacity(e), net.residual(e));
+    EXPECT_EQ(0, net.flow(e));
+  }
+
+  // Solving again starts from the original capacities.
+  EXPECT_EQ(3, edmonds_karp_max_flow(net, 0, 2));
+  EXPECT_EQ(3, edmonds_karp_max_flow(net, 0, 2));
+}
+
+TEST(FlowNetworkTest, MatchesSeparateMaps) {
+  std::mt19937 gen(7331);
+  for (size_t rep = 0; rep != 30; ++rep) {
+    const size_t num_v = 2 + rep;
+    flow_network<long> net(num_v);
+    directed_graph g(num_v);
+    std::vector<long> capacity;
+    std::vector<size_t> rev_edge;
+    std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+    std::uniform_int_distribution<long> cap_dist(0, 15);
+    for (size_t i = 0; i != 3 * num_v; ++i) {
+      const size_t u = vertex_dist(gen), v = vertex_dist(gen);
+      const long cap = cap_dist(gen), rev_cap = cap_dist(gen);
+      net.add_edge(u, v, cap, rev_cap);
+      const auto e1 = g.add_edge(u, v);
+      const auto e2 = g.add_edge(v, u);
+      capacity.push_back(cap);
+      capacity.push_back(rev_cap);
+      rev_edge.push_back(e2);
+      rev_edge.push_back(e1);
+    }
+
+    const size_t s = vertex_dist(gen);
+    const size_t t = (s + 1 + vertex_dist(gen) % (num_v - 1)) % num_v;
+
+    std::vector<long> residual;
+    const long expected =
+        edmonds_karp_max_flow(g, s, t, rev_edge, capacity, residual);
+    EXPECT_EQ(expected, edmonds_karp_max_flow(net, s, t));
+    for (size_t e = 0; e != net.num_edges(); ++e)
+      EXPECT_EQ(residual[e], net.residual(e));
+    EXPECT_EQ(expected, dinic_max_flow(net, s, t));
+    EXPECT_EQ(expected, push_relabel_max_flow(net, s, t));
+
+    std::vector<bool> expected_side, source_side;
+    min_st_cut(g, s, t, rev_edge, capacity, expected_side);
+    EXPECT_EQ(expected,
+              min_st_cut<cpl::dinic_engine>(net, s, t, source_side));
+    EXPECT_EQ(expected_side, source_side);
+  }
+}
+
+TEST(FlowNetworkTest, WorksWithGusfield) {
+  flow_network<long> net(6);
+  auto add_edge = [&](size_t u, size_t v, long cap) {
+    net.add_edge(u, v, cap, cap);
+  };
+
+  add_edge(0, 1, 1);
+  add_edge(0, 2, 7);
+  add_edge(1, 2, 1);
+  add_edge(1, 3, 3);
+  add_edge(1, 4, 2);
+  add_edge(2, 4, 4);
+  add_edge(3, 4, 1);
+  add_edge(3, 5, 6);
+  add_edge(4, 5, 2);
+
+  const auto cut = gusfield_all_pairs_min_cut(net);
+  ASSERT_EQ(6, cut.num_rows());
+  EXPECT_EQ(6, cut[0][1]);
+  EXPECT_EQ(8, cut[0][2]);
+  EXPECT_EQ(7, cut[1][4]);
+  EXPECT_EQ(8, cut[3][5]);
+  EXPECT_EQ(6, cut[4][5]);
+}
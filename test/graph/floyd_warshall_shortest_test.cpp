@@ -11,8 +11,10 @@
 #include <cstddef>                      // size_t
 #include <iterator>                     // back_inserter
 #include <limits>                       // numeric_limits
+#include <random>                       // mt19937
 #include <vector>                       // vector
 
+using cpl::blocked_floyd_warshall_all_pairs_shortest_paths;
 using cpl::floyd_warshall_all_pairs_shortest_paths;
 using cpl::floyd_warshall_path;
 using cpl::directed_graph;
@@ -151,3 +153,82 @@ TEST_F(FloydWarshallAPSPTest, PathTest) {
   floyd_warshall_path(8, 5, next, back_inserter(path));
   EXPECT_EQ(vector<size_t>({8, 5}), path);
 }
+
+TEST_F(FloydWarshallAPSPTest, BlockedVersionWorks) {
+  build_10_vertices_graph();
+  matrix<int> expected_dist{}, dist{};
+  matrix<size_t> next{};
+  floyd_warshall_all_pairs_shortest_paths(g, weight, expected_dist, next);
+
+  for (const size_t block_size : {1, 3, 4, 10, 64}) {
+    blocked_floyd_warshall_all_pairs_shortest_paths(g, weight, dist, next,
+                                                    block_size);
+    for (size_t i = 0; i != 10; ++i)
+      for (size_t j = 0; j != 10; ++j)
+        EXPECT_EQ(expected_dist[i][j], dist[i][j]);
+
+    vector<size_t> path;
+    floyd_warshall_path(9, 7, next, back_inserter(path));
+    EXPECT_EQ(vector<size_t>({9, 5, 0, 4, 8, 1, 2, 3, 7}), path);
+  }
+}
+
+TEST(FloydWarshallBlockedTest, MatchesTextbookVersion) {
+  const size_t num_v = 70;
+  std::mt19937 gen(17);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_int_distribution<long> weight_dist(0, 1000000);
+
+  directed_graph g(num_v);
+  vector<long> weight;
+  for (size_t i = 0; i != 5 * num_v; ++i) {
+    g.add_edge(vertex_dist(gen), vertex_dist(gen));
+    weight.push_back(weight_dist(gen));
+  }
+
+  matrix<long> expected_dist{}, dist{};
+  matrix<size_t> expected_next{}, next{};
+  floyd_warshall_all_pairs_shortest_paths(g, weight, expected_dist,
+                                          expected_next);
+  for (const size_t block_size : {7, 16, 32, 100}) {
+    blocked_floyd_warshall_all_pairs_shortest_paths(g, weight, dist, next,
+                                                    block_size);
+    for (size_t i = 0; i != num_v; ++i) {
+      for (size_t j = 0; j != num_v; ++j) {
+        ASSERT_EQ(expected_dist[i][j], dist[i][j]);
+        ASSERT_EQ(expected_next[i][j], next[i][j]);
+      }
+    }
+  }
+}
+
+TEST(FloydWarshallBlockedTest, ThreadedMatchesTextbookVersion) {
+  const size_t num_v = 150;
+  std::mt19937 gen(29);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_int_distribution<long> weight_dist(0, 1000000);
+
+  directed_graph g(num_v);
+  vector<long> weight;
+  for (size_t i = 0; i != 4 * num_v; ++i) {
+    g.add_edge(vertex_dist(gen), vertex_dist(gen));
+    weight.push_back(weight_dist(gen));
+  }
+
+  matrix<long> expected_dist{}, dist{};
+  matrix<size_t> expected_next{}, next{};
+  floyd_warshall_all_pairs_shortest_paths(g, weight, expected_dist,
+                                          expected_next);
+  for (const size_t num_threads : {2, 3, 8}) {
+    for (const size_t block_size : {8, 32}) {
+      blocked_floyd_warshall_all_pairs_shortest_paths(g, weight, dist, next,
+                                                      block_size, num_threads);
+      for (size_t i = 0; i != num_v; ++i) {
+        for (size_t j = 0; j != num_v; ++j) {
+          ASSERT_EQ(expected_dist[i][j], dist[i][j]);
+          ASSERT_EQ(expected_next[i][j], next[i][j]);
+        }
+      }
+    }
+  }
+}
@@ -6,13 +6,25 @@
 #include <cpl/graph/gusfield_all_pairs_min_cut.hpp>
 #include <gtest/gtest.h>
 
-#include <cpl/graph/directed_graph.hpp> // directed_graph
-#include <cpl/utility/matrix.hpp>       // matrix
-#include <cstddef>                      // size_t
-#include <vector>                       // vector
+#include <cpl/graph/dinic_max_flow.hpp>        // dinic_engine
+#include <cpl/graph/directed_graph.hpp>        // directed_graph
+#include <cpl/graph/flow_network.hpp>          // flow_network
+#include <cpl/graph/min_st_cut.hpp>            // min_st_cut
+#include <cpl/graph/push_relabel_max_flow.hpp> // push_relabel_engine
+#include <cpl/utility/matrix.hpp>              // matrix
+#include <cstddef>                             // size_t
+#include <limits>                              // numeric_limits
+#include <random>                              // mt19937
+#include <vector>                              // vector
 
 using cpl::gusfield_all_pairs_min_cut;
+using cpl::gusfield_gomory_hu_tree;
+using cpl::gomory_hu_cut_matrix;
+using cpl::min_st_cut;
+using cpl::dinic_engine;
+using cpl::push_relabel_engine;
 using cpl::directed_graph;
+using cpl::flow_network;
 using std::size_t;
 
 TEST(GusfieldAllPairsMinCutTest, SmallGraphTest) {
@@ -69,3 +81,157 @@ TEST(GusfieldAllPairsMinCutTest, SmallGraphTest) {
 
   EXPECT_EQ(6, cut[4][5]);
 }
+
+TEST(GusfieldAllPairsMinCutTest, MaxFlowEnginesAgree) {
+  directed_graph graph(6);
+  std::vector<size_t> rev_edge;
+  std::vector<long> capacity;
+
+  auto add_edge = [&](size_t u, size_t v, long cap) {
+    const auto e0 = graph.add_edge(u, v);
+    const auto e1 = graph.add_edge(v, u);
+    rev_edge.push_back(e1);
+    rev_edge.push_back(e0);
+    capacity.push_back(cap);
+    capacity.push_back(cap);
+  };
+
+  add_edge(0, 1, 1);
+  add_edge(0, 2, 7);
+  add_edge(1, 2, 1);
+  add_edge(1, 3, 3);
+  add_edge(1, 4, 2);
+  add_edge(2, 4, 4);
+  add_edge(3, 4, 1);
+  add_edge(3, 5, 6);
+  add_edge(4, 5, 2);
+
+  const auto expected = gusfield_all_pairs_min_cut(graph, rev_edge, capacity);
+  const auto dinic_cut =
+      gusfield_all_pairs_min_cut<dinic_engine>(graph, rev_edge, capacity);
+  const auto push_relabel_cut = gusfield_all_pairs_min_cut<push_relabel_engine>(
+      graph, rev_edge, capacity);
+
+  for (size_t i = 0; i < expected.num_rows(); ++i) {
+    for (size_t j = 0; j < expected.num_cols(); ++j) {
+      EXPECT_EQ(expected[i][j], dinic_cut[i][j]);
+      EXPECT_EQ(expected[i][j], push_relabel_cut[i][j]);
+    }
+  }
+}
+
+TEST(GusfieldAllPairsMinCutTest, BuildsGomoryHuTree) {
+  directed_graph graph(6);
+  std::vector<size_t> rev_edge;
+  std::vector<long> capacity;
+
+  auto add_edge = [&](size_t u, size_t v, long cap) {
+    const auto e0 = graph.add_edge(u, v);
+    const auto e1 = graph.add_edge(v, u);
+    rev_edge.push_back(e1);
+    rev_edge.push_back(e0);
+    capacity.push_back(cap);
+    capacity.push_back(cap);
+  };
+
+  add_edge(0, 1, 1);
+  add_edge(0, 2, 7);
+  add_edge(1, 2, 1);
+  add_edge(1, 3, 3);
+  add_edge(1, 4, 2);
+  add_edge(2, 4, 4);
+  add_edge(3, 4, 1);
+  add_edge(3, 5, 6);
+  add_edge(4, 5, 2);
+
+  std::vector<size_t> parent;
+  std::vector<long> weight;
+  gusfield_gomory_hu_tree(graph, rev_edge, capacity, parent, weight);
+  EXPECT_EQ(std::vector<size_t>({0, 0, 0, 1, 1, 3}), parent);
+  EXPECT_EQ(
+      std::vector<long>({std::numeric_limits<long>::max(), 6, 8, 6, 7, 8}),
+      weight);
+  const auto expected = gusfield_all_pairs_min_cut(graph, rev_edge, capacity);
+  const auto cut = gomory_hu_cut_matrix(parent, weight);
+  for (size_t i = 0; i != 6; ++i)
+    for (size_t j = 0; j != 6; ++j)
+      EXPECT_EQ(expected[i][j], cut[i][j]);
+}
+
+TEST(GusfieldAllPairsMinCutTest, MatchesMinSTCutOnRandomGraphs) {
+  std::mt19937 gen(1977);
+  for (size_t rep = 0; rep != 15; ++rep) {
+    const size_t num_v = 2 + rep;
+    directed_graph graph(num_v);
+    std::vector<size_t> rev_edge;
+    std::vector<int> capacity;
+    std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+    std::uniform_int_distribution<int> cap_dist(1, 10);
+    for (size_t i = 0; i != 2 * num_v; ++i) {
+      const auto e0 = graph.add_edge(vertex_dist(gen), vertex_dist(gen));
+      const auto e1 = graph.add_edge(graph.target(e0), graph.source(e0));
+      const int cap = cap_dist(gen);
+      rev_edge.push_back(e1);
+      rev_edge.push_back(e0);
+      capacity.push_back(cap);
+      capacity.push_back(cap);
+    }
+
+    std::vector<size_t> parent;
+    std::vector<int> weight;
+    gusfield_gomory_hu_tree<dinic_engine>(graph, rev_edge, capacity, parent,
+                                          weight);
+    for (size_t v = 1; v != num_v; ++v)
+      EXPECT_LT(parent[v], v);
+
+    const auto cut = gomory_hu_cut_matrix(parent, weight);
+    std::vector<bool> source_side;
+    for (size_t s = 0; s != num_v; ++s)
+      for (size_t t = 0; t != num_v; ++t)
+        if (s != t) {
+          EXPECT_EQ(min_st_cut(graph, s, t, rev_edge, capacity, source_side),
+                    cut[s][t]);
+        }
+  }
+}
+
+TEST(GusfieldAllPairsMinCutTest, ThreadedTreeMatchesSequential) {
+  std::mt19937 gen(31);
+  for (size_t rep = 0; rep != 10; ++rep) {
+    const size_t num_v = 5 + 7 * rep;
+    directed_graph graph(num_v);
+    flow_network<int> net(num_v);
+    std::vector<size_t> rev_edge;
+    std::vector<int> capacity;
+    std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+    std::uniform_int_distribution<int> cap_dist(1, 10);
+    for (size_t i = 0; i != 3 * num_v; ++i) {
+      const auto e0 = graph.add_edge(vertex_dist(gen), vertex_dist(gen));
+      const auto e1 = graph.add_edge(graph.target(e0), graph.source(e0));
+      const int cap = cap_dist(gen);
+      rev_edge.push_back(e1);
+      rev_edge.push_back(e0);
+      capacity.push_back(cap);
+      capacity.push_back(cap);
+      net.add_edge(graph.source(e0), graph.target(e0), cap, cap);
+    }
+
+    std::vector<size_t> expected_parent;
+    std::vector<int> expected_weight;
+    gusfield_gomory_hu_tree(graph, rev_edge, capacity, expected_parent,
+                            expected_weight);
+    for (const size_t num_threads : {2, 3, 4, 8}) {
+      std::vector<size_t> parent;
+      std::vector<int> weight;
+      gusfield_gomory_hu_tree<dinic_engine>(graph, rev_edge, capacity, parent,
+                                            weight, num_threads);
+      EXPECT_EQ(expected_parent, parent);
+      EXPECT_EQ(expected_weight, weight);
+
+      gusfield_gomory_hu_tree<push_relabel_engine>(net, parent, weight,
+                                                   num_threads);
+      EXPECT_EQ(expected_parent, parent);
+      EXPECT_EQ(expected_weight, weight);
+    }
+  }
+}
@@ -6,10 +6,19 @@
 #include <cpl/graph/hopcroft_karp_maximum_matching.hpp>
 #include <gtest/gtest.h>
 
+#include <cpl/graph/dinic_max_flow.hpp>   // dinic_max_flow
+#include <cpl/graph/directed_graph.hpp>   // directed_graph
 #include <cpl/graph/undirected_graph.hpp> // undirected_graph
+#include <cstddef>                        // size_t
+#include <limits>                         // numeric_limits
+#include <random>                         // mt19937
+#include <vector>                         // vector
 
 using cpl::undirected_graph;
 using cpl::hopcroft_karp_maximum_matching;
+using cpl::dinic_max_flow;
+using cpl::directed_graph;
+using std::size_t;
 
 TEST(HopcroftKarpMaximumMatchingTest, WorksOnDisconnectedGraphs) {
   undirected_graph graph(20);
@@ -92,3 +101,100 @@ TEST(HopcroftKarpMaximumMatchingTest, WorksForSingleOptionPairs) {
   graph.add_edge(4, 9);
   EXPECT_EQ(5, hopcroft_karp_maximum_matching(graph));
 }
+
+TEST(HopcroftKarpMaximumMatchingTest, ReturnsTheMatching) {
+  undirected_graph graph(7);
+  graph.add_edge(0, 3);
+  graph.add_edge(0, 4);
+  graph.add_edge(1, 3);
+  graph.add_edge(2, 4);
+  graph.add_edge(2, 5);
+
+  std::vector<size_t> mate;
+  EXPECT_EQ(3, hopcroft_karp_maximum_matching(graph, mate));
+  ASSERT_EQ(7, mate.size());
+  EXPECT_EQ(std::numeric_limits<size_t>::max(), mate[6]);
+
+  for (size_t v = 0; v != 6; ++v) {
+    ASSERT_NE(std::numeric_limits<size_t>::max(), mate[v]);
+    EXPECT_EQ(v, mate[mate[v]]);
+  }
+  // Vertex 1 can only be matched with 3, so 0 gets 4 and 2 gets 5.
+  EXPECT_EQ(3, mate[1]);
+  EXPECT_EQ(4, mate[0]);
+  EXPECT_EQ(5, mate[2]);
+}
+
+TEST(HopcroftKarpMaximumMatchingTest, AcceptsKnownBipartition) {
+  undirected_graph graph(6);
+  graph.add_edge(0, 3);
+  graph.add_edge(0, 4);
+  graph.add_edge(1, 3);
+  graph.add_edge(2, 5);
+  const std::vector<bool> color = {true, true, true, false, false, false};
+
+  std::vector<size_t> mate;
+  EXPECT_EQ(3, hopcroft_karp_maximum_matching(graph, color, mate));
+  EXPECT_EQ(std::vector<size_t>({4, 3, 5, 1, 0, 2}), mate);
+}
+
+TEST(HopcroftKarpMaximumMatchingTest, WorksOnLongPaths) {
+  const size_t n = 200001;
+  undirected_graph graph(n);
+  for (size_t v = 0; v + 1 < n; ++v)
+    graph.add_edge(v, v + 1);
+  EXPECT_EQ(n / 2, hopcroft_karp_maximum_matching(graph));
+}
+
+TEST(HopcroftKarpMaximumMatchingTest, MatchesMaxFlow) {
+  std::mt19937 gen(2718);
+  for (size_t rep = 0; rep != 40; ++rep) {
+    const size_t num_a = 1 + rep % 9, num_b = 1 + rep / 5;
+    const size_t n = num_a + num_b;
+    undirected_graph graph(n);
+
+    // Unit network: source -> A -> B -> target.
+    directed_graph network(n + 2);
+    std::vector<size_t> rev_edge;
+    std::vector<int> capacity;
+    auto add_arc = [&](size_t u, size_t v) {
+      const auto e1 = network.add_edge(u, v);
+      const auto e2 = network.add_edge(v, u);
+      rev_edge.push_back(e2);
+      rev_edge.push_back(e1);
+      capacity.push_back(1);
+      capacity.push_back(0);
+    };
+    for (size_t a = 0; a != num_a; ++a)
+      add_arc(n, a);
+    for (size_t b = num_a; b != n; ++b)
+      add_arc(b, n + 1);
+
+    std::bernoulli_distribution connect(0.3);
+    for (size_t a = 0; a != num_a; ++a) {
+      for (size_t b = num_a; b != n; ++b) {
+        if (connect(gen)) {
+          // Alternate the endpoint order, edges are undirected.
+          rep % 2 ? graph.add_edge(a, b) : graph.add_edge(b, a);
+          add_arc(a, b);
+        }
+      }
+    }
+
+    std::vector<int> residual;
+    std::vector<size_t> mate;
+    const size_t size = hopcroft_karp_maximum_matching(graph, mate);
+    EXPECT_EQ(dinic_max_flow(network, n, n + 1, rev_edge, capacity, residual),
+              static_cast<int>(size));
+
+    size_t num_matched = 0;
+    for (size_t v = 0; v != n; ++v) {
+      if (mate[v] == std::numeric_limits<size_t>::max())
+        continue;
+      ++num_matched;
+      EXPECT_EQ(v, mate[mate[v]]);
+      EXPECT_NE(v < num_a, mate[v] < num_a);
+    }
+    EXPECT_EQ(2 * size, num_matched);
+  }
+}
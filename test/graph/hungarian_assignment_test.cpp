@@ -0,0 +1,90 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/hungarian_assignment.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/utility/matrix.hpp> // matrix
+#include <algorithm>              // adjacent_find, min, next_permutation
+#include <cstddef>                // size_t
+#include <limits>                 // numeric_limits
+#include <numeric>                // iota
+#include <random>                 // mt19937
+#include <vector>                 // vector
+
+using cpl::hungarian_assignment;
+using cpl::matrix;
+using std::size_t;
+
+// Tries every injection of rows into columns.
+static long brute_force_assignment(const matrix<long>& cost) {
+  std::vector<size_t> cols(cost.num_cols());
+  std::iota(cols.begin(), cols.end(), size_t{0});
+  long best = std::numeric_limits<long>::max();
+  do {
+    long total = 0;
+    for (size_t i = 0; i != cost.num_rows(); ++i)
+      total += cost[i][cols[i]];
+    best = std::min(best, total);
+  } while (std::next_permutation(cols.begin(), cols.end()));
+  return best;
+}
+
+TEST(HungarianAssignmentTest, WorksOnSmallCase) {
+  matrix<int> cost({3, 3});
+  const int values[3][3] = {{4, 1, 3}, {2, 0, 5}, {3, 2, 2}};
+  for (size_t i = 0; i != 3; ++i)
+    for (size_t j = 0; j != 3; ++j)
+      cost[i][j] = values[i][j];
+
+  std::vector<size_t> assignment;
+  EXPECT_EQ(5, hungarian_assignment(cost, assignment));
+  EXPECT_EQ(std::vector<size_t>({1, 0, 2}), assignment);
+}
+
+TEST(HungarianAssignmentTest, WorksOnEmptyMatrix) {
+  matrix<int> cost({0, 0});
+  std::vector<size_t> assignment;
+  EXPECT_EQ(0, hungarian_assignment(cost, assignment));
+  EXPECT_TRUE(assignment.empty());
+}
+
+TEST(HungarianAssignmentTest, WorksWithMoreColumnsThanRows) {
+  matrix<double> cost({2, 4});
+  const double values[2][4] = {{5.5, 1.5, 9, 2}, {1, 2.5, 3, 0.5}};
+  for (size_t i = 0; i != 2; ++i)
+    for (size_t j = 0; j != 4; ++j)
+      cost[i][j] = values[i][j];
+
+  std::vector<size_t> assignment;
+  EXPECT_DOUBLE_EQ(2.0, hungarian_assignment(cost, assignment));
+  EXPECT_EQ(std::vector<size_t>({1, 3}), assignment);
+}
+
+TEST(HungarianAssignmentTest, MatchesBruteForce) {
+  std::mt19937 gen(31337);
+  std::uniform_int_distribution<long> cost_dist(-50, 100);
+  for (size_t rows = 1; rows <= 6; ++rows) {
+    for (size_t cols = rows; cols <= 7; ++cols) {
+      matrix<long> cost({rows, cols});
+      for (size_t i = 0; i != rows; ++i)
+        for (size_t j = 0; j != cols; ++j)
+          cost[i][j] = cost_dist(gen);
+
+      std::vector<size_t> assignment;
+      const long total = hungarian_assignment(cost, assignment);
+      EXPECT_EQ(brute_force_assignment(cost), total);
+
+      ASSERT_EQ(rows, assignment.size());
+      long assigned_cost = 0;
+      for (size_t i = 0; i != rows; ++i)
+        assigned_cost += cost[i][assignment[i]];
+      EXPECT_EQ(total, assigned_cost);
+      std::sort(assignment.begin(), assignment.end());
+      EXPECT_TRUE(std::adjacent_find(assignment.begin(), assignment.end()) ==
+                  assignment.end());
+    }
+  }
+}
@@ -0,0 +1,77 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/johnson_all_pairs_shortest_paths.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/directed_graph.hpp>          // directed_graph
+#include <cpl/graph/floyd_warshall_shortest.hpp> // floyd_warshall_all_pairs_...
+#include <cpl/utility/matrix.hpp>                // matrix
+#include <cstddef>                               // size_t
+#include <limits>                                // numeric_limits
+#include <random>                                // mt19937
+#include <utility>                               // swap
+#include <vector>                                // vector
+
+using cpl::directed_graph;
+using cpl::johnson_all_pairs_shortest_paths;
+using cpl::matrix;
+using std::size_t;
+
+TEST(JohnsonAllPairsShortestPathsTest, MatchesFloydWarshall) {
+  const size_t num_v = 60;
+  std::mt19937 gen(19);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_int_distribution<long> weight_dist(-10, 100);
+
+  // Edges only go from lower to higher vertices, so there are no cycles.
+  directed_graph g(num_v);
+  std::vector<long> weight;
+  for (size_t i = 0; i != 3 * num_v; ++i) {
+    size_t u = vertex_dist(gen), v = vertex_dist(gen);
+    if (u > v)
+      std::swap(u, v);
+    g.add_edge(u, v);
+    weight.push_back(u == v ? 0 : weight_dist(gen));
+  }
+  // Positive back edges.
+  for (size_t i = 0; i != num_v; ++i) {
+    const size_t u = vertex_dist(gen);
+    g.add_edge(u, u / 2);
+    weight.push_back(1000);
+  }
+
+  matrix<long> expected{}, dist{};
+  matrix<size_t> next{};
+  cpl::floyd_warshall_all_pairs_shortest_paths(g, weight, expected, next);
+  for (const size_t num_threads : {1, 2, 5}) {
+    ASSERT_TRUE(johnson_all_pairs_shortest_paths(g, weight, dist, num_threads));
+    for (size_t u = 0; u != num_v; ++u)
+      for (size_t v = 0; v != num_v; ++v)
+        ASSERT_EQ(expected[u][v], dist[u][v]) << u << ' ' << v;
+  }
+}
+
+TEST(JohnsonAllPairsShortestPathsTest, DetectsNegativeCycles) {
+  directed_graph g(4);
+  g.add_edge(0, 1);
+  g.add_edge(1, 2);
+  g.add_edge(2, 1);
+  g.add_edge(3, 3);
+  std::vector<int> weight = {5, -2, 1, 0};
+
+  matrix<int> dist{};
+  EXPECT_FALSE(johnson_all_pairs_shortest_paths(g, weight, dist));
+
+  weight[2] = 2;
+  EXPECT_TRUE(johnson_all_pairs_shortest_paths(g, weight, dist));
+  EXPECT_EQ(3, dist[0][2]);
+  EXPECT_EQ(2, dist[2][1]);
+  EXPECT_EQ(0, dist[3][3]);
+  EXPECT_EQ(std::numeric_limits<int>::max(), dist[1][0]);
+
+  weight[3] = -1;
+  EXPECT_FALSE(johnson_all_pairs_shortest_paths(g, weight, dist));
+}
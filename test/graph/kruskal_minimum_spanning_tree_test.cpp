@@ -6,10 +6,16 @@
 #include <cpl/graph/kruskal_minimum_spanning_tree.hpp>
 #include <gtest/gtest.h>
 
+#include <cpl/data_structure/concurrent_disjoint_set.hpp>
 #include <cpl/graph/undirected_graph.hpp> // undirected_graph
+#include <cstddef>                        // size_t
+#include <random>                         // mt19937
 
+using cpl::concurrent_disjoint_set;
+using cpl::filter_kruskal_minimum_spanning_tree;
 using cpl::kruskal_minimum_spanning_tree;
 using cpl::undirected_graph;
+using std::size_t;
 using std::vector;
 
 TEST(KruskalMinimumSpanningTreeTest, WorksOnEmptyGraph) {
@@ -64,3 +70,77 @@ TEST(KruskalMinimumSpanningTreeTest, WorksOnCyclicGraphs) {
 
   EXPECT_EQ(vector<size_t>({4, 3, 6, 2}), mst_edges);
 }
+
+TEST(KruskalMinimumSpanningTreeTest, FilterKruskalWorksOnSmallGraphs) {
+  undirected_graph graph(5);
+  vector<int> weight_of;
+  auto add_edge = [&](size_t u, size_t v, int weight) {
+    graph.add_edge(u, v);
+    weight_of.push_back(weight);
+  };
+  add_edge(0, 2, 8); // 0
+  add_edge(2, 3, 5); // 1
+  add_edge(3, 0, 6); // 2
+  add_edge(1, 3, 3); // 3
+  add_edge(1, 2, 2); // 4
+  add_edge(2, 4, 7); // 5
+  add_edge(1, 4, 4); // 6
+
+  EXPECT_EQ(vector<size_t>({4, 3, 6, 2}),
+            filter_kruskal_minimum_spanning_tree(graph, weight_of));
+  EXPECT_EQ(0, filter_kruskal_minimum_spanning_tree(undirected_graph(0),
+                                                    vector<int>())
+                   .size());
+}
+
+TEST(KruskalMinimumSpanningTreeTest, FilterKruskalMatchesKruskal) {
+  std::mt19937 gen(1234);
+  for (size_t rep = 0; rep != 20; ++rep) {
+    // Few distinct weights, so there are plenty of ties.
+    const size_t n = 50 + 50 * rep, m = n * (1 + rep % 6);
+    std::uniform_int_distribution<size_t> vertex(0, n - 1);
+    std::uniform_int_distribution<int> weight(-5, 5 + 100 * (rep % 2));
+    undirected_graph graph(n);
+    vector<int> weight_of;
+    for (size_t i = 0; i != m; ++i) {
+      graph.add_edge(vertex(gen), vertex(gen));
+      weight_of.push_back(weight(gen));
+    }
+
+    const auto expected = kruskal_minimum_spanning_tree(graph, weight_of);
+    const auto tree = filter_kruskal_minimum_spanning_tree(graph, weight_of);
+    ASSERT_EQ(expected.size(), tree.size());
+    long long expected_weight = 0, tree_weight = 0;
+    for (size_t i = 0; i != tree.size(); ++i) {
+      expected_weight += weight_of[expected[i]];
+      tree_weight += weight_of[tree[i]];
+      if (i != 0) {
+        EXPECT_LE(weight_of[tree[i - 1]], weight_of[tree[i]]);
+      }
+    }
+    EXPECT_EQ(expected_weight, tree_weight);
+  }
+}
+
+TEST(KruskalMinimumSpanningTreeTest, AcceptsOtherDisjointSets) {
+  undirected_graph graph(5);
+  vector<int> weight_of;
+  auto add_edge = [&](size_t u, size_t v, int weight) {
+    graph.add_edge(u, v);
+    weight_of.push_back(weight);
+  };
+  add_edge(0, 2, 8); // 0
+  add_edge(2, 3, 5); // 1
+  add_edge(3, 0, 6); // 2
+  add_edge(1, 3, 3); // 3
+  add_edge(1, 2, 2); // 4
+  add_edge(2, 4, 7); // 5
+  add_edge(1, 4, 4); // 6
+
+  const vector<size_t> expected = {4, 3, 6, 2};
+  EXPECT_EQ(expected, kruskal_minimum_spanning_tree<concurrent_disjoint_set>(
+                          graph, weight_of));
+  EXPECT_EQ(expected,
+            filter_kruskal_minimum_spanning_tree<concurrent_disjoint_set>(
+                graph, weight_of));
+}
@@ -0,0 +1,177 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/dinic_max_flow.hpp>
+#include <cpl/graph/edmonds_karp_max_flow.hpp>
+#include <cpl/graph/push_relabel_max_flow.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/directed_graph.hpp> // directed_graph
+#include <cstddef>                      // size_t
+#include <random>                       // mt19937
+#include <vector>                       // vector
+
+using cpl::edmonds_karp_max_flow;
+using cpl::directed_graph;
+using std::size_t;
+
+// Common tests of the max-flow engines, which take the same arguments.
+template <typename MaxFlow>
+class MaxFlowTest : public ::testing::Test {};
+
+typedef ::testing::Types<cpl::edmonds_karp_engine, cpl::dinic_engine,
+                         cpl::push_relabel_engine>
+    MaxFlowEngines;
+TYPED_TEST_CASE(MaxFlowTest, MaxFlowEngines);
+
+TYPED_TEST(MaxFlowTest, WorksOnBasicCases) {
+  directed_graph g(4);
+  std::vector<unsigned> capacity;
+  std::vector<size_t> rev_edge;
+  auto add_edge = [&](size_t s, size_t t, unsigned cap, unsigned rev_cap = 0) {
+    const auto e1 = g.add_edge(s, t);
+    const auto e2 = g.add_edge(t, s);
+    capacity.push_back(cap);
+    capacity.push_back(rev_cap);
+    rev_edge.push_back(e2);
+    rev_edge.push_back(e1);
+  };
+
+  add_edge(0, 1, 20, 20);
+  add_edge(0, 2, 10);
+  add_edge(1, 2, 5);
+  add_edge(1, 3, 10);
+  add_edge(2, 3, 20, 15);
+
+  TypeParam max_flow;
+  std::vector<unsigned> residual;
+  auto calc_max_flow = [&](size_t src, size_t tgt) {
+    return max_flow(g, src, tgt, rev_edge, capacity, residual);
+  };
+
+  EXPECT_EQ(20, calc_max_flow(0, 1));
+  EXPECT_EQ(25, calc_max_flow(0, 2));
+  EXPECT_EQ(25, calc_max_flow(0, 3));
+
+  EXPECT_EQ(20, calc_max_flow(1, 0));
+  EXPECT_EQ(25, calc_max_flow(1, 2));
+  EXPECT_EQ(25, calc_max_flow(1, 3));
+
+  EXPECT_EQ(0, calc_max_flow(2, 0));
+  EXPECT_EQ(0, calc_max_flow(2, 1));
+  EXPECT_EQ(20, calc_max_flow(2, 3));
+
+  EXPECT_EQ(0, calc_max_flow(3, 0));
+  EXPECT_EQ(0, calc_max_flow(3, 1));
+  EXPECT_EQ(15, calc_max_flow(3, 2));
+}
+
+TYPED_TEST(MaxFlowTest, WorksWhenNeedsUndoing) {
+  directed_graph g(12);
+  std::vector<unsigned> capacity;
+  std::vector<size_t> rev_edge;
+  auto add_edge = [&](size_t s, size_t t) {
+    const auto e1 = g.add_edge(s, t);
+    const auto e2 = g.add_edge(t, s);
+    capacity.push_back(1);
+    capacity.push_back(0);
+    rev_edge.push_back(e2);
+    rev_edge.push_back(e1);
+  };
+  add_edge(0, 1);
+  add_edge(0, 2);
+  add_edge(0, 3);
+  add_edge(1, 4);
+  add_edge(2, 5);
+  add_edge(2, 6);
+  add_edge(3, 7);
+  add_edge(4, 8);
+  add_edge(4, 9);
+  add_edge(5, 8);
+  add_edge(5, 10);
+  add_edge(6, 9);
+  add_edge(6, 10);
+  add_edge(7, 10);
+  add_edge(8, 11);
+  add_edge(9, 11);
+  add_edge(10, 11);
+
+  std::vector<unsigned> flow;
+  EXPECT_EQ(3, TypeParam()(g, 0, 11, rev_edge, capacity, flow));
+}
+
+TYPED_TEST(MaxFlowTest, AgreesWithEdmondsKarp) {
+  std::mt19937 gen(4242);
+  TypeParam max_flow; // Reused, along with its workspace.
+  for (size_t rep = 0; rep != 40; ++rep) {
+    const size_t num_v = 2 + rep;
+    directed_graph g(num_v);
+    std::vector<long> capacity;
+    std::vector<size_t> rev_edge;
+    std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+    std::uniform_int_distribution<long> cap_dist(0, 20);
+    for (size_t i = 0; i != 4 * num_v; ++i) {
+      const auto e1 = g.add_edge(vertex_dist(gen), vertex_dist(gen));
+      const auto e2 = g.add_edge(g.target(e1), g.source(e1));
+      capacity.push_back(cap_dist(gen));
+      capacity.push_back(rep % 2 ? cap_dist(gen) : 0);
+      rev_edge.push_back(e2);
+      rev_edge.push_back(e1);
+    }
+
+    const size_t s = vertex_dist(gen);
+    size_t t = vertex_dist(gen);
+    if (s == t)
+      t = (s + 1) % num_v;
+
+    std::vector<long> residual, expected_residual;
+    const long flow = max_flow(g, s, t, rev_edge, capacity, residual);
+    EXPECT_EQ(edmonds_karp_max_flow(g, s, t, rev_edge, capacity,
+                                    expected_residual),
+              flow);
+
+    // The residual capacities must describe a valid flow.
+    std::vector<long> balance(num_v);
+    for (size_t e = 0; e != g.num_edges(); e += 2) {
+      EXPECT_GE(residual[e], 0);
+      EXPECT_GE(residual[e + 1], 0);
+      EXPECT_EQ(capacity[e] + capacity[e + 1], residual[e] + residual[e + 1]);
+      const long f = capacity[e] - residual[e];
+      balance[g.source(e)] -= f;
+      balance[g.target(e)] += f;
+    }
+    for (size_t v = 0; v != num_v; ++v) {
+      const long expected_balance = v == s ? -flow : v == t ? flow : 0;
+      EXPECT_EQ(expected_balance, balance[v]);
+    }
+  }
+}
+
+TYPED_TEST(MaxFlowTest, ReusesWorkspaceOnSmallerGraphs) {
+  std::mt19937 gen(9876);
+  TypeParam max_flow;
+  for (size_t num_v = 60; num_v >= 2; num_v -= 3) {
+    directed_graph g(num_v);
+    std::vector<int> capacity;
+    std::vector<size_t> rev_edge;
+    std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+    std::uniform_int_distribution<int> cap_dist(1, 9);
+    for (size_t i = 0; i != 3 * num_v; ++i) {
+      const auto e1 = g.add_edge(vertex_dist(gen), vertex_dist(gen));
+      const auto e2 = g.add_edge(g.target(e1), g.source(e1));
+      capacity.push_back(cap_dist(gen));
+      capacity.push_back(0);
+      rev_edge.push_back(e2);
+      rev_edge.push_back(e1);
+    }
+
+    std::vector<int> residual, expected_residual;
+    for (size_t t = 1; t < num_v; t += 5) {
+      EXPECT_EQ(edmonds_karp_max_flow(g, 0, t, rev_edge, capacity,
+                                      expected_residual),
+                max_flow(g, 0, t, rev_edge, capacity, residual));
+    }
+  }
+}
@@ -0,0 +1,178 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/min_cost_max_flow.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/bellman_ford_shortest_paths.hpp>
+#include <cpl/graph/directed_graph.hpp> // directed_graph
+#include <cstddef>                      // size_t
+#include <random>                       // mt19937
+#include <utility>                      // pair
+#include <vector>                       // vector
+
+using cpl::min_cost_max_flow;
+using cpl::cost_scaling_min_cost_max_flow;
+using cpl::bellman_ford_shortest_paths;
+using cpl::directed_graph;
+using std::size_t;
+
+namespace {
+
+struct network {
+  directed_graph g;
+  std::vector<size_t> rev_edge;
+  std::vector<int> capacity;
+  std::vector<long> cost;
+
+  explicit network(size_t n) : g(n) {}
+
+  void add_edge(size_t s, size_t t, int cap, long c) {
+    const auto e1 = g.add_edge(s, t);
+    const auto e2 = g.add_edge(t, s);
+    rev_edge.push_back(e2);
+    rev_edge.push_back(e1);
+    capacity.push_back(cap);
+    capacity.push_back(0);
+    cost.push_back(c);
+    cost.push_back(-c);
+  }
+};
+
+// A flow has minimum cost iff its residual graph has no negative cycle.
+bool is_min_cost(const network& net, const std::vector<int>& flow) {
+  const size_t num_v = net.g.num_vertices();
+  directed_graph residual_graph(num_v + 1);
+  std::vector<long> weight;
+  for (size_t e = 0; e != net.g.num_edges(); ++e) {
+    const size_t rev = net.rev_edge[e];
+    if (net.capacity[e] - flow[e] + flow[rev] > 0) {
+      residual_graph.add_edge(net.g.source(e), net.g.target(e));
+      weight.push_back(net.cost[e]);
+    }
+  }
+  for (size_t v = 0; v != num_v; ++v) {
+    residual_graph.add_edge(num_v, v);
+    weight.push_back(0);
+  }
+  std::vector<long> dist;
+  return bellman_ford_shortest_paths(residual_graph, num_v, weight, dist);
+}
+
+// Transport instance: 'num_supply' suppliers and 'num_demand' consumers
+// between a super source and a super sink.
+network make_transport(size_t num_supply, size_t num_demand,
+                       std::mt19937& gen) {
+  const size_t num_v = num_supply + num_demand + 2;
+  const size_t s = num_v - 2, t = num_v - 1;
+  network net(num_v);
+  std::uniform_int_distribution<int> amount_dist(1, 30);
+  std::uniform_int_distribution<long> cost_dist(-5, 40);
+  std::bernoulli_distribution connect(0.5);
+  for (size_t i = 0; i != num_supply; ++i)
+    net.add_edge(s, i, amount_dist(gen), 0);
+  for (size_t j = 0; j != num_demand; ++j)
+    net.add_edge(num_supply + j, t, amount_dist(gen), 0);
+  for (size_t i = 0; i != num_supply; ++i)
+    for (size_t j = 0; j != num_demand; ++j)
+      if (connect(gen))
+        net.add_edge(i, num_supply + j, amount_dist(gen), cost_dist(gen));
+  return net;
+}
+
+} // end anonymous namespace
+
+TEST(MinCostMaxFlowTest, WorksOnSmallCase) {
+  network net(4);
+  net.add_edge(0, 1, 2, 1);
+  net.add_edge(0, 2, 1, 2);
+  net.add_edge(1, 2, 1, 1);
+  net.add_edge(1, 3, 1, 3);
+  net.add_edge(2, 3, 2, 1);
+
+  std::vector<int> flow;
+  const auto result = min_cost_max_flow(net.g, 0, 3, net.rev_edge,
+                                        net.capacity, net.cost, flow);
+  EXPECT_EQ(3, result.first);
+  EXPECT_EQ(10, result.second);
+  EXPECT_EQ(std::vector<int>({2, 0, 1, 0, 1, 0, 1, 0, 2, 0}), flow);
+
+  const auto scaled = cost_scaling_min_cost_max_flow(
+      net.g, 0, 3, net.rev_edge, net.capacity, net.cost, flow);
+  EXPECT_EQ(result, scaled);
+  EXPECT_EQ(std::vector<int>({2, 0, 1, 0, 1, 0, 1, 0, 2, 0}), flow);
+}
+
+TEST(MinCostMaxFlowTest, PrefersCheapPathsOverShortOnes) {
+  network net(5);
+  net.add_edge(0, 4, 1, 100);
+  net.add_edge(0, 1, 1, 1);
+  net.add_edge(1, 2, 1, 1);
+  net.add_edge(2, 3, 1, 1);
+  net.add_edge(3, 4, 1, 1);
+
+  std::vector<int> flow;
+  EXPECT_EQ(std::make_pair(2, 104L),
+            min_cost_max_flow(net.g, 0, 4, net.rev_edge, net.capacity,
+                              net.cost, flow));
+  EXPECT_EQ(std::make_pair(2, 104L),
+            cost_scaling_min_cost_max_flow(net.g, 0, 4, net.rev_edge,
+                                           net.capacity, net.cost, flow));
+}
+
+TEST(MinCostMaxFlowTest, HandlesUnreachableTarget) {
+  network net(3);
+  net.add_edge(0, 1, 4, 2);
+  net.add_edge(2, 1, 4, 2);
+
+  std::vector<int> flow;
+  EXPECT_EQ(std::make_pair(0, 0L),
+            min_cost_max_flow(net.g, 0, 2, net.rev_edge, net.capacity,
+                              net.cost, flow));
+  EXPECT_EQ(std::vector<int>(4, 0), flow);
+  EXPECT_EQ(std::make_pair(0, 0L),
+            cost_scaling_min_cost_max_flow(net.g, 0, 2, net.rev_edge,
+                                           net.capacity, net.cost, flow));
+}
+
+TEST(MinCostMaxFlowTest, SolvesTransportInstances) {
+  std::mt19937 gen(2015);
+  for (size_t rep = 0; rep != 30; ++rep) {
+    const auto net = make_transport(1 + rep % 7, 1 + rep / 4, gen);
+    const size_t s = net.g.num_vertices() - 2;
+    const size_t t = net.g.num_vertices() - 1;
+
+    std::vector<int> flow1, flow2;
+    const auto result1 = min_cost_max_flow(net.g, s, t, net.rev_edge,
+                                           net.capacity, net.cost, flow1);
+    const auto result2 = cost_scaling_min_cost_max_flow(
+        net.g, s, t, net.rev_edge, net.capacity, net.cost, flow2);
+    EXPECT_EQ(result1, result2);
+    EXPECT_TRUE(is_min_cost(net, flow1));
+    EXPECT_TRUE(is_min_cost(net, flow2));
+
+    long total_cost = 0;
+    for (size_t e = 0; e != net.g.num_edges(); ++e) {
+      EXPECT_GE(flow2[e], 0);
+      EXPECT_LE(flow2[e], net.capacity[e]);
+      total_cost += flow2[e] * net.cost[e];
+    }
+    EXPECT_EQ(result2.second, total_cost);
+  }
+}
+
+TEST(MinCostMaxFlowTest, CostScalingHandlesNegativeCycles) {
+  network net(4);
+  net.add_edge(0, 1, 1, 1);
+  net.add_edge(1, 3, 1, 1);
+  net.add_edge(1, 2, 5, -3);
+  net.add_edge(2, 1, 5, 1);
+
+  std::vector<int> flow;
+  // The cycle 1 -> 2 -> 1 costs -2 per unit and gets saturated with 5 units.
+  EXPECT_EQ(std::make_pair(1, -8L),
+            cost_scaling_min_cost_max_flow(net.g, 0, 3, net.rev_edge,
+                                           net.capacity, net.cost, flow));
+}
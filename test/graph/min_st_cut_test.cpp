@@ -6,14 +6,18 @@
 #include <cpl/graph/min_st_cut.hpp>
 #include <gtest/gtest.h>
 
-#include <cpl/graph/directed_graph.hpp> // directed_graph
-#include <algorithm>                    // transform
-#include <cassert>                      // assert
-#include <cstddef>                      // size_t
-#include <iterator>                     // back_inserter
-#include <vector>                       // vector
+#include <cpl/graph/dinic_max_flow.hpp>        // dinic_engine
+#include <cpl/graph/directed_graph.hpp>        // directed_graph
+#include <cpl/graph/push_relabel_max_flow.hpp> // push_relabel_engine
+#include <algorithm>                           // transform
+#include <cassert>                             // assert
+#include <cstddef>                             // size_t
+#include <iterator>                            // back_inserter
+#include <vector>                              // vector
 
 using cpl::min_st_cut;
+using cpl::dinic_engine;
+using cpl::push_relabel_engine;
 using cpl::directed_graph;
 using std::size_t;
 using std::back_inserter;
@@ -125,3 +129,38 @@ TEST(MinSTCutTest, BidirGraphTest) {
   EXPECT_EQ(2 * 9, cut_set[0]);
   EXPECT_EQ(2 * 15, cut_set[1]);
 }
+
+TEST(MinSTCutTest, WorksWithOtherMaxFlowEngines) {
+  directed_graph graph(6);
+  std::vector<size_t> rev_edge;
+  std::vector<long> capacity;
+
+  auto add_edge = [&](size_t s, size_t t, long cap) {
+    const auto e1 = graph.add_edge(s, t);
+    const auto e2 = graph.add_edge(t, s);
+    rev_edge.push_back(e2);
+    rev_edge.push_back(e1);
+    capacity.push_back(cap);
+    capacity.push_back(0);
+  };
+
+  add_edge(0, 1, 16);
+  add_edge(0, 2, 13);
+  add_edge(1, 2, 10);
+  add_edge(1, 3, 12);
+  add_edge(2, 1, 4);
+  add_edge(2, 4, 14);
+  add_edge(3, 2, 9);
+  add_edge(3, 5, 20);
+  add_edge(4, 3, 7);
+  add_edge(4, 5, 4);
+
+  bool_vec source_side;
+  EXPECT_EQ(23, min_st_cut<dinic_engine>(graph, 0, 5, rev_edge, capacity,
+                                         source_side));
+  EXPECT_EQ(make_bool_vec("111010"), source_side);
+
+  EXPECT_EQ(23, min_st_cut<push_relabel_engine>(graph, 0, 5, rev_edge,
+                                                capacity, source_side));
+  EXPECT_EQ(make_bool_vec("111010"), source_side);
+}
@@ -0,0 +1,82 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/offline_dynamic_connectivity.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/data_structure/disjoint_set.hpp> // disjoint_set
+#include <cstddef>                             // size_t
+#include <random>                              // mt19937
+#include <utility>                             // pair
+#include <vector>                              // vector
+
+using cpl::disjoint_set;
+using cpl::offline_dynamic_connectivity;
+using std::size_t;
+
+TEST(OfflineDynamicConnectivityTest, WorksWithoutQueries) {
+  offline_dynamic_connectivity log(3);
+  log.add_edge(0, 1);
+  log.remove_edge(1, 0);
+  EXPECT_TRUE(log.solve().empty());
+}
+
+TEST(OfflineDynamicConnectivityTest, WorksOnSmallLogs) {
+  offline_dynamic_connectivity log(5);
+  log.query(0, 0);
+  log.query(0, 1);
+  log.add_edge(0, 1);
+  log.add_edge(1, 2);
+  log.query(0, 2);
+  log.add_edge(2, 0);
+  log.remove_edge(1, 2);
+  log.query(0, 2);
+  log.query(1, 2);
+  log.remove_edge(0, 2);
+  log.query(1, 2);
+  log.add_edge(3, 4);
+  log.add_edge(3, 4);
+  log.remove_edge(4, 3);
+  log.query(3, 4); // A parallel copy is still there.
+  log.remove_edge(3, 4);
+  log.query(3, 4);
+
+  EXPECT_EQ(std::vector<bool>(
+                {true, false, true, true, true, false, true, false}),
+            log.solve());
+}
+
+TEST(OfflineDynamicConnectivityTest, MatchesRecomputation) {
+  std::mt19937 gen(8080);
+  for (size_t rep = 0; rep != 10; ++rep) {
+    const size_t n = 5 + 10 * rep;
+    std::uniform_int_distribution<size_t> vertex(0, n - 1);
+    std::uniform_int_distribution<size_t> action(0, 9);
+
+    offline_dynamic_connectivity log(n);
+    std::vector<std::pair<size_t, size_t>> alive;
+    std::vector<bool> expected;
+    for (size_t step = 0; step != 600; ++step) {
+      const size_t a = action(gen);
+      if (a < 4) {
+        alive.emplace_back(vertex(gen), vertex(gen));
+        log.add_edge(alive.back().first, alive.back().second);
+      } else if (a < 6 && !alive.empty()) {
+        std::uniform_int_distribution<size_t> pick(0, alive.size() - 1);
+        std::swap(alive[pick(gen)], alive.back());
+        log.remove_edge(alive.back().second, alive.back().first);
+        alive.pop_back();
+      } else {
+        const size_t u = vertex(gen), v = vertex(gen);
+        log.query(u, v);
+        disjoint_set dset(n);
+        for (const auto& edge : alive)
+          dset.union_set(edge.first, edge.second);
+        expected.push_back(dset.find_set(u) == dset.find_set(v));
+      }
+    }
+    EXPECT_EQ(expected, log.solve());
+  }
+}
@@ -0,0 +1,119 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/shortest_path_engine.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/dijkstra_shortest_paths.hpp> // dijkstra_shortest_paths
+#include <cpl/graph/directed_graph.hpp>          // directed_graph
+#include <cstddef>                               // size_t
+#include <cstdint>                               // uint32_t
+#include <limits>                                // numeric_limits
+#include <random>                                // mt19937
+#include <vector>                                // vector
+
+using cpl::basic_directed_graph;
+using cpl::batch_shortest_paths;
+using cpl::dijkstra_shortest_paths;
+using cpl::directed_graph;
+using cpl::shortest_path_engine;
+using std::size_t;
+
+TEST(ShortestPathEngineTest, ResetsTouchedVertices) {
+  directed_graph graph(5);
+  std::vector<int> weight_of;
+  auto add_edge = [&](size_t u, size_t v, int weight) {
+    graph.add_edge(u, v);
+    weight_of.push_back(weight);
+  };
+
+  add_edge(0, 1, 2);
+  add_edge(1, 2, 3);
+  add_edge(3, 4, 1);
+
+  const int inf = std::numeric_limits<int>::max();
+  shortest_path_engine<directed_graph, int> engine(graph, weight_of);
+
+  EXPECT_EQ((std::vector<int>{0, 2, 5, inf, inf}), engine.run(0));
+  EXPECT_EQ((std::vector<size_t>{0, 1, 2}), engine.reached_vertices());
+
+  EXPECT_EQ((std::vector<int>{inf, inf, inf, 0, 1}), engine.run(3));
+  EXPECT_EQ((std::vector<size_t>{3, 4}), engine.reached_vertices());
+  EXPECT_EQ(1, engine.distance(4));
+  EXPECT_EQ(inf, engine.distance(1));
+}
+
+TEST(ShortestPathEngineTest, MatchesDijkstra) {
+  using graph_type = basic_directed_graph<uint32_t>;
+  const size_t num_v = 300;
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_real_distribution<double> weight_dist(0.0, 10.0);
+
+  graph_type graph(num_v);
+  std::vector<double> weight_of;
+  for (size_t i = 0; i != 2 * num_v; ++i) {
+    graph.add_edge(vertex_dist(gen), vertex_dist(gen));
+    weight_of.push_back(weight_dist(gen));
+  }
+
+  std::vector<size_t> sources;
+  for (size_t source = 0; source < num_v; source += 7)
+    sources.push_back(source);
+
+  shortest_path_engine<graph_type, double, 2> engine(graph, weight_of);
+  size_t num_queries = 0;
+  engine.run(sources.begin(), sources.end(),
+             [&](const size_t source, const std::vector<double>& dist,
+                 const std::vector<uint32_t>& reached) {
+               EXPECT_EQ(dijkstra_shortest_paths(graph, source, weight_of),
+                         dist);
+               EXPECT_EQ(&engine.reached_vertices(), &reached);
+               ++num_queries;
+             });
+  EXPECT_EQ(sources.size(), num_queries);
+}
+
+TEST(ShortestPathEngineTest, BatchMatchesDijkstra) {
+  const size_t num_v = 500;
+  std::mt19937 gen(23);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_int_distribution<long> weight_dist(0, 100);
+
+  directed_graph graph(num_v);
+  std::vector<long> weight_of;
+  for (size_t i = 0; i != 4 * num_v; ++i) {
+    graph.add_edge(vertex_dist(gen), vertex_dist(gen));
+    weight_of.push_back(weight_dist(gen));
+  }
+
+  std::vector<size_t> sources;
+  for (size_t source = 0; source < num_v; source += 3)
+    sources.push_back(source);
+
+  for (const size_t num_threads : {1, 2, 4, 8}) {
+    // Each source is reported once, so threads write different entries.
+    std::vector<std::vector<long>> dist_from(num_v);
+    std::vector<size_t> reached_from(num_v, 0);
+    batch_shortest_paths(graph, weight_of, sources, num_threads,
+                         [&](const size_t source, const std::vector<long>& d,
+                             const std::vector<size_t>& reached) {
+                           dist_from[source] = d;
+                           reached_from[source] = reached.size();
+                         });
+    for (size_t source = 0; source != num_v; ++source) {
+      if (source % 3 == 0) {
+        const auto expected = dijkstra_shortest_paths(graph, source, weight_of);
+        EXPECT_EQ(expected, dist_from[source]);
+        size_t num_reached = 0;
+        for (const long d : expected)
+          num_reached += d != std::numeric_limits<long>::max();
+        EXPECT_EQ(num_reached, reached_from[source]);
+      } else {
+        EXPECT_TRUE(dist_from[source].empty());
+      }
+    }
+  }
+}
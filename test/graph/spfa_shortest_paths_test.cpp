@@ -0,0 +1,145 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/graph/spfa_shortest_paths.hpp>
+#include <gtest/gtest.h>
+
+#include <cpl/graph/bellman_ford_shortest_paths.hpp>
+#include <cpl/graph/directed_graph.hpp> // directed_graph
+#include <cstddef>                      // size_t
+#include <limits>                       // numeric_limits
+#include <random>                       // mt19937
+#include <vector>                       // vector
+
+using cpl::bellman_ford_shortest_paths;
+using cpl::directed_graph;
+using cpl::spfa_heuristic;
+using cpl::spfa_shortest_paths;
+using std::size_t;
+using dist_vec = std::vector<long>;
+using index_vec = std::vector<size_t>;
+
+static const spfa_heuristic all_heuristics[] = {
+    spfa_heuristic::none, spfa_heuristic::small_label_first,
+    spfa_heuristic::large_label_last, spfa_heuristic::both};
+
+TEST(SpfaShortestPathsTest, ComputesDistancesAndPredecessors) {
+  directed_graph graph(7);
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 3);
+  graph.add_edge(2, 5);
+  graph.add_edge(3, 4);
+  graph.add_edge(3, 6);
+  graph.add_edge(4, 0);
+  graph.add_edge(6, 4);
+  const dist_vec weight_of = {2, 4, 3, -4, 1, -20, -10, 21};
+
+  const size_t nil = std::numeric_limits<size_t>::max();
+  for (const auto heuristic : all_heuristics) {
+    dist_vec dist;
+    index_vec pred, cycle;
+    EXPECT_TRUE(
+        spfa_shortest_paths(graph, 1, weight_of, dist, pred, cycle, heuristic));
+    EXPECT_EQ(dist_vec({-2, 0, 4, 7, 8, 0, -13}), dist);
+    EXPECT_EQ(index_vec({6, nil, 1, 2, 4, 3, 5}), pred);
+    EXPECT_TRUE(cycle.empty());
+  }
+}
+
+TEST(SpfaShortestPathsTest, HandlesLargeIntegralDistances) {
+  // The distances fit in an int, but their sum over the queue does not.
+  const size_t num_leaves = 8;
+  directed_graph graph(num_leaves + 2);
+  std::vector<int> weight_of;
+  for (size_t v = 1; v <= num_leaves; ++v) {
+    graph.add_edge(0, v);
+    weight_of.push_back(1000000000 + static_cast<int>(v));
+    graph.add_edge(v, num_leaves + 1);
+    weight_of.push_back(-static_cast<int>(v));
+  }
+
+  std::vector<int> expected(num_leaves + 2, 0);
+  for (size_t v = 1; v <= num_leaves; ++v)
+    expected[v] = 1000000000 + static_cast<int>(v);
+  expected[num_leaves + 1] = 1000000000;
+  for (const auto heuristic : all_heuristics) {
+    std::vector<int> dist;
+    index_vec pred, cycle;
+    EXPECT_TRUE(
+        spfa_shortest_paths(graph, 0, weight_of, dist, pred, cycle, heuristic));
+    EXPECT_EQ(expected, dist);
+  }
+}
+
+TEST(SpfaShortestPathsTest, ExtractsNegativeCycles) {
+  directed_graph graph(6);
+  graph.add_edge(0, 1);
+  graph.add_edge(1, 2);
+  graph.add_edge(2, 3);
+  graph.add_edge(3, 1);
+  graph.add_edge(3, 4);
+  graph.add_edge(5, 5);
+  dist_vec weight_of = {1, 2, -5, 1, 1, -1};
+
+  for (const auto heuristic : all_heuristics) {
+    dist_vec dist;
+    index_vec pred, cycle;
+    EXPECT_FALSE(
+        spfa_shortest_paths(graph, 0, weight_of, dist, pred, cycle, heuristic));
+    ASSERT_EQ(3u, cycle.size());
+    for (size_t i = 0; i != cycle.size(); ++i) {
+      const size_t next = cycle[(i + 1) % cycle.size()];
+      EXPECT_EQ(graph.target(cycle[i]), graph.source(next));
+    }
+
+    // The loop on 5 is not reachable from 0.
+    weight_of[3] = 3;
+    EXPECT_TRUE(
+        spfa_shortest_paths(graph, 0, weight_of, dist, pred, cycle, heuristic));
+    EXPECT_FALSE(
+        spfa_shortest_paths(graph, 5, weight_of, dist, pred, cycle, heuristic));
+    EXPECT_EQ(index_vec{5}, cycle);
+    weight_of[3] = 1;
+  }
+}
+
+TEST(SpfaShortestPathsTest, MatchesBellmanFord) {
+  const size_t num_v = 150;
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<size_t> vertex_dist(0, num_v - 1);
+  std::uniform_int_distribution<long> weight_dist(-5, 40);
+
+  directed_graph graph(num_v);
+  dist_vec weight_of;
+  for (size_t i = 0; i != 4 * num_v; ++i) {
+    graph.add_edge(vertex_dist(gen), vertex_dist(gen));
+    weight_of.push_back(weight_dist(gen));
+  }
+
+  for (size_t source = 0; source < num_v; source += 13) {
+    dist_vec expected;
+    const bool no_cycle =
+        bellman_ford_shortest_paths(graph, source, weight_of, expected);
+    for (const auto heuristic : all_heuristics) {
+      dist_vec dist;
+      index_vec pred, cycle;
+      ASSERT_EQ(no_cycle, spfa_shortest_paths(graph, source, weight_of, dist,
+                                              pred, cycle, heuristic));
+      if (!no_cycle) {
+        long cycle_weight = 0;
+        for (const size_t e : cycle)
+          cycle_weight += weight_of[e];
+        EXPECT_LT(cycle_weight, 0);
+        continue;
+      }
+      EXPECT_EQ(expected, dist);
+      for (size_t v = 0; v != num_v; ++v)
+        if (v != source && dist[v] != std::numeric_limits<long>::max()) {
+          EXPECT_EQ(dist[v], dist[graph.source(pred[v])] + weight_of[pred[v]]);
+        }
+    }
+  }
+}
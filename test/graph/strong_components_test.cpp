@@ -8,11 +8,15 @@
 
 #include <cpl/graph/directed_graph.hpp> // directed_graph
 #include <cstddef>                      // size_t
+#include <cstdint>                      // uint32_t
 #include <numeric>                      // iota
+#include <random>                       // mt19937
 #include <unordered_map>                // unordered_map
 #include <vector>                       // vector
 
+using cpl::forward_backward_strong_components;
 using cpl::strong_components;
+using cpl::basic_directed_graph;
 using cpl::directed_graph;
 using std::vector;
 
@@ -67,6 +71,11 @@ static void check_scc(const directed_graph& g, const size_t total_scc,
 
   const auto cg = make_condensate(g, total_scc, comp);
   EXPECT_TRUE(check_cg_toposort(cg));
+
+  vector<size_t> fb_comp;
+  EXPECT_EQ(total_scc, forward_backward_strong_components(g, fb_comp));
+  EXPECT_EQ(expected, normalize(fb_comp));
+  EXPECT_TRUE(check_cg_toposort(make_condensate(g, total_scc, fb_comp)));
 }
 
 TEST(StrongComponentsTest, EmptyGraphTest) {
@@ -184,3 +193,95 @@ TEST(StrongComponentsTest, BidirectionalTreeTest) {
   EXPECT_EQ(8, g.num_edges());
   check_scc(g, 1, {0, 0, 0, 0, 0});
 }
+
+TEST(StrongComponentsTest, WorksWithNarrowIndexTypes) {
+  basic_directed_graph<uint32_t> g(5);
+  g.add_edge(0, 1);
+  g.add_edge(1, 0);
+  g.add_edge(1, 2);
+  g.add_edge(2, 3);
+  g.add_edge(3, 4);
+  g.add_edge(4, 2);
+
+  vector<uint32_t> comp;
+  EXPECT_EQ(2u, strong_components(g, comp));
+  EXPECT_EQ(vector<uint32_t>({1, 1, 0, 0, 0}), comp);
+}
+
+TEST(StrongComponentsTest, ForwardBackwardWorksWithNarrowIndexTypes) {
+  basic_directed_graph<uint32_t> g(5);
+  g.add_edge(0, 1);
+  g.add_edge(1, 0);
+  g.add_edge(1, 2);
+  g.add_edge(2, 3);
+  g.add_edge(3, 4);
+  g.add_edge(4, 2);
+
+  vector<uint32_t> comp;
+  EXPECT_EQ(2u, forward_backward_strong_components(g, comp));
+  EXPECT_EQ(vector<uint32_t>({1, 1, 0, 0, 0}), comp);
+}
+
+TEST(StrongComponentsTest, ForwardBackwardMatchesTarjan) {
+  std::mt19937 gen(1357);
+  for (size_t rep = 0; rep != 40; ++rep) {
+    const size_t n = 1 + 25 * rep;
+    // From mostly trivial components to a giant one.
+    const size_t m = n * (rep % 5) / 2;
+    std::uniform_int_distribution<size_t> vertex(0, n - 1);
+    directed_graph g(n);
+    for (size_t i = 0; i != m; ++i)
+      g.add_edge(vertex(gen), vertex(gen));
+
+    vector<size_t> expected, comp;
+    const size_t total_scc = strong_components(g, expected);
+    EXPECT_EQ(total_scc, forward_backward_strong_components(g, comp));
+    EXPECT_EQ(normalize(expected), normalize(comp));
+    EXPECT_TRUE(check_cg_toposort(make_condensate(g, total_scc, comp)));
+
+    // Small subproblems run concurrently, but get the same labels.
+    vector<size_t> threaded_comp;
+    EXPECT_EQ(total_scc,
+              forward_backward_strong_components(g, threaded_comp, 3));
+    EXPECT_EQ(comp, threaded_comp);
+  }
+}
+
+TEST(StrongComponentsTest, ForwardBackwardThreadedMatchesSequential) {
+  // Large enough for the trimming and search levels to be split.
+  std::mt19937 gen(2468);
+  for (const size_t avg_degree : {1, 2, 4}) {
+    const size_t n = 40000;
+    std::uniform_int_distribution<size_t> vertex(0, n - 1);
+    directed_graph g(n);
+    for (size_t i = 0; i != avg_degree * n; ++i)
+      g.add_edge(vertex(gen), vertex(gen));
+
+    vector<size_t> expected, comp;
+    const size_t total_scc = forward_backward_strong_components(g, expected);
+    EXPECT_EQ(total_scc, strong_components(g, comp));
+    EXPECT_EQ(normalize(comp), normalize(expected));
+    for (const size_t num_threads : {2, 3, 4, 8}) {
+      EXPECT_EQ(total_scc,
+                forward_backward_strong_components(g, comp, num_threads));
+      EXPECT_EQ(expected, comp);
+    }
+  }
+}
+
+TEST(StrongComponentsTest, ForwardBackwardWorksOnDeepGraphs) {
+  // A long cycle, and a long path of 2-cycles.
+  const size_t n = 50000;
+  directed_graph g(2 * n);
+  for (size_t v = 0; v != n; ++v)
+    g.add_edge(v, (v + 1) % n);
+  for (size_t v = n; v + 1 != 2 * n; ++v) {
+    g.add_edge(v, v + 1);
+    if (v % 2 == 0)
+      g.add_edge(v + 1, v);
+  }
+
+  vector<size_t> comp;
+  EXPECT_EQ(1 + n / 2, forward_backward_strong_components(g, comp));
+  EXPECT_TRUE(check_cg_toposort(make_condensate(g, 1 + n / 2, comp)));
+}
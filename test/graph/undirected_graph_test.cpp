@@ -8,8 +8,11 @@
 
 #include <algorithm> // any_of
 #include <cstddef>   // size_t
+#include <cstdint>   // uint32_t
 #include <iterator>  // begin, end
+#include <vector>    // vector
 
+using cpl::basic_undirected_graph;
 using cpl::undirected_graph;
 using std::begin;
 using std::end;
@@ -58,3 +61,14 @@ TEST(UndirectedGraphTest, LinksWell) {
   EXPECT_TRUE(connects_to(2, 0));
   EXPECT_TRUE(connects_to(0, 2));
 }
+
+TEST(UndirectedGraphTest, SupportsNarrowIndexTypes) {
+  basic_undirected_graph<uint32_t> g(3);
+  g.add_edge(0, 1);
+  g.add_edge(2, 1);
+
+  EXPECT_EQ(3u, g.num_vertices());
+  EXPECT_EQ(2u, g.num_edges());
+  EXPECT_EQ(std::vector<uint32_t>({0, 1}), g.out_edges(1));
+  EXPECT_EQ(1u, g.degree(2));
+}
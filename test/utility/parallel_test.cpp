@@ -0,0 +1,46 @@
+//          Copyright Diego Ramirez 2015
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cpl/utility/parallel.hpp>
+#include <gtest/gtest.h>
+
+#include <cstddef> // size_t
+#include <vector>  // vector
+
+using cpl::parallel_for;
+using cpl::parallel_num_chunks;
+using std::size_t;
+
+TEST(ParallelForTest, NumChunks) {
+  EXPECT_EQ(0, parallel_num_chunks(0, 4));
+  EXPECT_EQ(1, parallel_num_chunks(10, 0));
+  EXPECT_EQ(1, parallel_num_chunks(10, 1));
+  EXPECT_EQ(3, parallel_num_chunks(3, 8));
+  EXPECT_EQ(8, parallel_num_chunks(100, 8));
+}
+
+TEST(ParallelForTest, CoversEachItemOnce) {
+  for (size_t n = 0; n != 40; ++n) {
+    for (size_t num_threads = 0; num_threads != 6; ++num_threads) {
+      const size_t num_chunks = parallel_num_chunks(n, num_threads);
+      std::vector<int> times(n, 0);
+      std::vector<size_t> first_of(num_chunks), last_of(num_chunks);
+      parallel_for(n, num_threads,
+                   [&](size_t chunk, size_t first, size_t last) {
+                     first_of[chunk] = first;
+                     last_of[chunk] = last;
+                     for (size_t i = first; i != last; ++i)
+                       ++times[i];
+                   });
+      EXPECT_EQ(std::vector<int>(n, 1), times);
+      for (size_t chunk = 0; chunk != num_chunks; ++chunk) {
+        EXPECT_LT(first_of[chunk], last_of[chunk]);
+        if (chunk != 0) {
+          EXPECT_EQ(last_of[chunk - 1], first_of[chunk]);
+        }
+      }
+    }
+  }
+}